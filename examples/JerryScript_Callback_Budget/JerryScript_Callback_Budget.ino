@@ -0,0 +1,87 @@
+#include "Arduino.h"
+#include "mbed.h"
+
+#include "Arduino_Portenta_JerryScript.h"
+
+REDIRECT_STDOUT_TO(Serial);
+
+/* Busy loop used to measure the overhead of the VM halt checks */
+const char bench_js[] =
+  "function bench () {"
+  "  var start = micros ();"
+  "  var sum = 0;"
+  "  for (var i = 0; i < 100000; i++) { sum += i; }"
+  "  return micros () - start;"
+  "}";
+
+/* Run the benchmark from a timer callback, so it runs under the budget */
+void run_bench(const char *label) {
+  char script[128];
+  snprintf(script, sizeof(script), "setTimeout (function () { print ('%s', bench (), 'us'); }, 0);", label);
+  jerry_value_free(jerry_eval((const jerry_char_t *)script, strlen(script), JERRY_PARSE_NO_OPTS));
+  jerryxx_run_event_loop();
+}
+
+void setup() {
+  /* Initialize Serial */
+  Serial.begin(115200);
+
+  /* Wait Serial */
+  while (!Serial) {}
+
+  printf("\n");
+  printf("Arduino Core API: %d.%d.%d\n", CORE_MAJOR, CORE_MINOR, CORE_PATCH);
+  printf("Mbed OS API: %d.%d.%d\n", MBED_MAJOR_VERSION, MBED_MINOR_VERSION, MBED_PATCH_VERSION);
+  printf("JerryScript API: %d.%d.%d\n", JERRY_API_MAJOR_VERSION, JERRY_API_MINOR_VERSION, JERRY_API_PATCH_VERSION);
+
+  /* Initialize engine */
+  jerry_init(JERRY_INIT_EMPTY);
+
+  /* Set log level */
+  jerry_log_set_level(JERRY_LOG_LEVEL_DEBUG);
+
+  /* Register the extra API (print, setTimeout ...) in the global object */
+  jerryxx_register_extra_api();
+
+  /* Register the Arduino API in the global object */
+  jerryxx_register_arduino_api();
+
+  jerry_value_free(jerry_eval((const jerry_char_t *)bench_js, sizeof(bench_js) - 1, JERRY_PARSE_NO_OPTS));
+
+  /* Baseline without the halt callback */
+  run_bench("no budget:");
+
+  /* Overhead of the halt checks: a budget large enough to never expire */
+  const uint32_t intervals[] = { 1, 16, 256, 4096 };
+  for (size_t i = 0; i < sizeof(intervals) / sizeof(intervals[0]); i++) {
+    char label[32];
+    snprintf(label, sizeof(label), "interval %lu:", (unsigned long)intervals[i]);
+    jerryxx_set_callback_budget(60000, JERRYXX_BUDGET_THROW, intervals[i]);
+    run_bench(label);
+  }
+
+  /* A runaway callback is stopped with an error: the catch block runs, then the callback is ended anyway */
+  const char throw_js[] =
+    "setCallbackBudget (50, BUDGET_THROW);"
+    "setTimeout (function () { try { while (true) {} } catch (e) { print ('caught:', e); } }, 0);";
+  jerry_value_free(jerry_eval((const jerry_char_t *)throw_js, sizeof(throw_js) - 1, JERRY_PARSE_NO_OPTS));
+  jerryxx_run_event_loop();
+
+  /* ... or aborted, even if the script tries to catch it */
+  const char abort_js[] =
+    "setCallbackBudget (50, BUDGET_ABORT);"
+    "setTimeout (function () { try { while (true) {} } catch (e) { print ('never printed'); } }, 0);"
+    "setTimeout (function () { print ('next callback runs'); }, 10);";
+  jerry_value_free(jerry_eval((const jerry_char_t *)abort_js, sizeof(abort_js) - 1, JERRY_PARSE_NO_OPTS));
+  jerryxx_run_event_loop();
+
+  /* Release the pending timers */
+  jerryxx_cleanup_scheduler();
+
+  /* Cleanup engine */
+  jerry_cleanup();
+}
+
+void loop() {
+  delay(1000);
+}
@@ -0,0 +1,77 @@
+#include "Arduino.h"
+#include "mbed.h"
+
+#include "Arduino_Portenta_JerryScript.h"
+
+REDIRECT_STDOUT_TO(Serial);
+
+/* Toggle LED_BUILTIN and read D6 with the functions and with the pin objects */
+const char bench_js[] =
+  "var COUNT = 10000;"
+  "function bench (label, fn) {"
+  "  var start = micros ();"
+  "  fn ();"
+  "  var elapsed = micros () - start;"
+  "  print (label, elapsed, 'us,', (elapsed * 1000 / COUNT).toFixed (0), 'ns per call');"
+  "}"
+  "pinMode (LED_BUILTIN, OUTPUT);"
+  "pinMode (D6, INPUT);"
+  "bench ('digitalWrite:', function () {"
+  "  for (var i = 0; i < COUNT; i++) { digitalWrite (LED_BUILTIN, i & 1); }"
+  "});"
+  "bench ('digitalRead:', function () {"
+  "  for (var i = 0; i < COUNT; i++) { digitalRead (D6); }"
+  "});"
+  "var led = new DigitalOut (LED_BUILTIN);"
+  "var input = new DigitalIn (D6);"
+  "bench ('DigitalOut.write:', function () {"
+  "  for (var i = 0; i < COUNT; i++) { led.write (i & 1); }"
+  "});"
+  "bench ('DigitalOut.toggle:', function () {"
+  "  for (var i = 0; i < COUNT; i++) { led.toggle (); }"
+  "});"
+  "bench ('DigitalIn.read:', function () {"
+  "  for (var i = 0; i < COUNT; i++) { input.read (); }"
+  "});"
+  "bench ('empty loop:', function () {"
+  "  for (var i = 0; i < COUNT; i++) {}"
+  "});";
+
+void setup() {
+  /* Initialize Serial */
+  Serial.begin(115200);
+
+  /* Wait Serial */
+  while (!Serial) {}
+
+  printf("\n");
+  printf("Arduino Core API: %d.%d.%d\n", CORE_MAJOR, CORE_MINOR, CORE_PATCH);
+  printf("Mbed OS API: %d.%d.%d\n", MBED_MAJOR_VERSION, MBED_MINOR_VERSION, MBED_PATCH_VERSION);
+  printf("JerryScript API: %d.%d.%d\n", JERRY_API_MAJOR_VERSION, JERRY_API_MINOR_VERSION, JERRY_API_PATCH_VERSION);
+
+  /* Initialize engine */
+  jerry_init(JERRY_INIT_EMPTY);
+
+  /* Set log level */
+  jerry_log_set_level(JERRY_LOG_LEVEL_DEBUG);
+
+  /* Register the extra API (print, setTimeout ...) in the global object */
+  jerryxx_register_extra_api();
+
+  /* Register the Arduino API in the global object */
+  jerryxx_register_arduino_api();
+
+  jerry_value_t result = jerry_eval((const jerry_char_t *)bench_js, sizeof(bench_js) - 1, JERRY_PARSE_NO_OPTS);
+  if (jerry_value_is_exception(result)) {
+    jerryx_print_unhandled_exception(result);
+  } else {
+    jerry_value_free(result);
+  }
+
+  /* Cleanup engine */
+  jerry_cleanup();
+}
+
+void loop() {
+  delay(1000);
+}
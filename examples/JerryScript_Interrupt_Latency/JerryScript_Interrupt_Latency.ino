@@ -0,0 +1,88 @@
+#include "Arduino.h"
+#include "mbed.h"
+
+#include "Arduino_Portenta_JerryScript.h"
+
+REDIRECT_STDOUT_TO(Serial);
+
+/* Wire OUTPUT_PIN to INPUT_PIN */
+#define OUTPUT_PIN D5
+#define INPUT_PIN D6
+
+/* Toggle the output pin and count the edges seen by the handler */
+const char setup_js[] =
+  "var edges = 0;"
+  "pinMode (OUTPUT_PIN, OUTPUT);"
+  "pinMode (INPUT_PIN, INPUT);"
+  "function report (label) {"
+  "  var latency = getInterruptLatency ();"
+  "  print (label, 'edges:', edges);"
+  "  ['dequeue', 'start', 'callback'].forEach (function (stage) {"
+  "    var s = latency[stage];"
+  "    print ('  ' + stage + ':', 'count', s.count, 'min', s.min, 'avg', s.avg, 'max', s.max, 'p99', s.p99, 'us');"
+  "  });"
+  "}";
+
+/* Run a phase of the benchmark: toggle for 2 s, with an optional busy timer loading the event loop */
+void run_phase(const char *label, uint32_t load_ms) {
+  char script[768];
+  snprintf(script, sizeof(script),
+           "edges = 0;"
+           "resetInterruptLatency ();"
+           "attachInterrupt (INPUT_PIN, function (pin, edge, timestamp) { edges++; }, CHANGE);"
+           "var level = LOW;"
+           "var toggle = setInterval (function () { level = level === LOW ? HIGH : LOW; digitalWrite (OUTPUT_PIN, level); }, 2);"
+           "var load = %lu > 0 ? setInterval (function () { var start = micros (); while (micros () - start < %lu * 1000) {} }, 5) : 0;"
+           "setTimeout (function () { clearInterval (toggle); if (load) { clearInterval (load); } detachInterrupt (INPUT_PIN); report ('%s'); }, 2000);",
+           (unsigned long)load_ms, (unsigned long)load_ms, label);
+  jerry_value_free(jerry_eval((const jerry_char_t *)script, strlen(script), JERRY_PARSE_NO_OPTS));
+  jerryxx_run_event_loop();
+}
+
+void setup() {
+  /* Initialize Serial */
+  Serial.begin(115200);
+
+  /* Wait Serial */
+  while (!Serial) {}
+
+  printf("\n");
+  printf("Arduino Core API: %d.%d.%d\n", CORE_MAJOR, CORE_MINOR, CORE_PATCH);
+  printf("Mbed OS API: %d.%d.%d\n", MBED_MAJOR_VERSION, MBED_MINOR_VERSION, MBED_PATCH_VERSION);
+  printf("JerryScript API: %d.%d.%d\n", JERRY_API_MAJOR_VERSION, JERRY_API_MINOR_VERSION, JERRY_API_PATCH_VERSION);
+
+  /* Initialize engine */
+  jerry_init(JERRY_INIT_EMPTY);
+
+  /* Set log level */
+  jerry_log_set_level(JERRY_LOG_LEVEL_DEBUG);
+
+  /* Register the extra API (print, setTimeout ...) in the global object */
+  jerryxx_register_extra_api();
+
+  /* Register the Arduino API in the global object */
+  jerryxx_register_arduino_api();
+
+  /* Loopback pins */
+  jerry_value_t global = jerry_current_realm();
+  jerry_value_free(jerry_object_set_sz(global, "OUTPUT_PIN", jerry_number(OUTPUT_PIN)));
+  jerry_value_free(jerry_object_set_sz(global, "INPUT_PIN", jerry_number(INPUT_PIN)));
+  jerry_value_free(global);
+
+  jerry_value_free(jerry_eval((const jerry_char_t *)setup_js, sizeof(setup_js) - 1, JERRY_PARSE_NO_OPTS));
+
+  /* Idle event loop, then loaded by a timer callback busy for 1 and 4 ms */
+  run_phase("idle", 0);
+  run_phase("load 1 ms", 1);
+  run_phase("load 4 ms", 4);
+
+  /* Release the pending timers */
+  jerryxx_cleanup_scheduler();
+
+  /* Cleanup engine */
+  jerry_cleanup();
+}
+
+void loop() {
+  delay(1000);
+}
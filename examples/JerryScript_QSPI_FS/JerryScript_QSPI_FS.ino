@@ -103,11 +103,17 @@ void setup() {
     jerry_value_free(parsed_code);
 
     jerry_port_source_free(source_p);
+
+    /* Run the timers scheduled by the script */
+    jerryxx_run_event_loop();
   } else {
     /* Read Evaluate Print Loop */
     jerryx_repl("js>");
   }
 
+  /* Release the pending timers */
+  jerryxx_cleanup_scheduler();
+
   /* Cleanup engine */
   jerry_cleanup();
 }
@@ -33,6 +33,9 @@ void setup() {
   /* Read Evaluate Print Loop */
   jerryx_repl("js>");
 
+  /* Release the pending timers */
+  jerryxx_cleanup_scheduler ();
+
   /* Cleanup engine */
   jerry_cleanup ();
 }
@@ -25,7 +25,6 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
-#include <unordered_map>
 
 #include "Arduino_Portenta_JerryScript.h"
 
@@ -77,6 +76,16 @@ jerry_port_current_time(void)
   return result;
 } /* jerry_port_current_time */
 
+/**
+ * Implementation of jerry_port_sleep. Blocks only the calling thread,
+ * so the RTOS can enter the low power mode while it waits.
+ */
+void JERRY_ATTR_WEAK
+jerry_port_sleep(uint32_t sleep_time) /**< milliseconds to sleep */
+{
+  rtos::ThisThread::sleep_for(std::chrono::milliseconds(sleep_time));
+} /* jerry_port_sleep */
+
 /**
  * Dummy function to get the time zone adjustment.
  *
@@ -146,6 +155,9 @@ jerry_port_line_read(jerry_size_t *out_size_p)
 {
   while (true)
   {
+    /* Keep timers running while waiting for input */
+    jerryxx_scheduler_yield();
+
     if (Serial.available())
     {
       String data = "";
@@ -157,6 +169,9 @@ jerry_port_line_read(jerry_size_t *out_size_p)
       *out_size_p = data.length();
       return (jerry_char_t *)((*out_size_p > 0) ? (new String(data))->c_str() : NULL);
     }
+
+    /* Sleep until the next timer, polling the serial input */
+    jerryxx_scheduler_idle(JERRYXX_LINE_READ_POLL_MS);
   }
 
 } /* jerry_port_line_read */
@@ -336,525 +351,6957 @@ jerry_port_context_free(void)
  *                                   Extra API                                 *
  ******************************************************************************/
 
-static std::unordered_map<int, rtos::Thread *> jerryxx_scheduler_threads_map;
-static rtos::Mutex jerryxx_scheduler_threads_mutex;
+/**
+ * Hierarchical timing wheel used by setTimeout and setInterval.
+ *
+ * Every level has 64 slots, a slot of level N covers 64^N ticks of one
+ * millisecond. Timers are taken from a preallocated pool and linked into
+ * the slots with intrusive doubly linked lists, so arming and cancelling
+ * a timer is O(1) and never touches the heap. Timers further than the
+ * range of the last level are parked in it and re-armed when cascaded.
+ */
+#define JERRYXX_TIMER_WHEEL_BITS 6
+#define JERRYXX_TIMER_WHEEL_SLOTS (1u << JERRYXX_TIMER_WHEEL_BITS)
+#define JERRYXX_TIMER_WHEEL_MASK (JERRYXX_TIMER_WHEEL_SLOTS - 1)
+#define JERRYXX_TIMER_WHEEL_LEVELS 4
+
+/**
+ * Slot value of the timers which are not linked into the wheel.
+ */
+#define JERRYXX_TIMER_SLOT_NONE 0xFFFF
+
+/**
+ * Link of an intrusive doubly linked list of timers.
+ */
+typedef struct jerryxx_timer_link_s
+{
+  struct jerryxx_timer_link_s *next_p; /**< next element */
+  struct jerryxx_timer_link_s *prev_p; /**< previous element */
+} jerryxx_timer_link_t;
+
+/**
+ * State of a timer of the pool.
+ */
+typedef enum
+{
+  JERRYXX_TIMER_FREE,    /**< in the free list */
+  JERRYXX_TIMER_ARMED,   /**< waiting in a slot of the wheel */
+  JERRYXX_TIMER_DUE,     /**< expired, waiting for its callback to be called */
+  JERRYXX_TIMER_RUNNING, /**< its callback is running */
+} jerryxx_timer_state_t;
+
+/**
+ * What a timer does when it expires.
+ */
+typedef enum
+{
+  JERRYXX_TIMER_CALLBACK, /**< call a function */
+  JERRYXX_TIMER_PROMISE,  /**< resolve a Promise */
+  JERRYXX_TIMER_IDLE,     /**< call a function when the other lanes are empty */
+} jerryxx_timer_kind_t;
+
+/**
+ * Policy of setInterval, the fixed-rate ones schedule against absolute deadlines.
+ */
+typedef enum
+{
+  JERRYXX_INTERVAL_FIXED_DELAY, /**< wait the period after every call */
+  JERRYXX_INTERVAL_SKIP,        /**< fixed-rate, drop the missed periods */
+  JERRYXX_INTERVAL_CATCH_UP,    /**< fixed-rate, call back to back for the missed periods */
+  JERRYXX_INTERVAL_COALESCE,    /**< fixed-rate, one call receiving the number of elapsed periods */
+} jerryxx_interval_policy_t;
+
+/**
+ * Timer record armed by setTimeout and setInterval.
+ */
+typedef struct
+{
+  jerryxx_timer_link_t link; /**< link into a slot, the due list or the free list */
+  uint64_t deadline;         /**< absolute deadline in microseconds */
+  uint32_t interval;         /**< repeat period in milliseconds, 0 for one-shot timers */
+  jerry_value_t callback_fn; /**< function to call, or Promise to resolve, on expiration */
+  uint16_t generation;       /**< incremented every time the record is released */
+  uint16_t slot;             /**< index of the slot in the wheel */
+  uint8_t state;             /**< jerryxx_timer_state_t */
+  uint8_t kind;              /**< jerryxx_timer_kind_t */
+  uint8_t policy;            /**< jerryxx_interval_policy_t */
+  bool cancelled;            /**< cleared while its callback was running */
+  bool aligned;              /**< expiration delayed within the slack to a later tick */
+  bool shared;               /**< expired in the same tick as other timers */
+  uint32_t slack;            /**< tolerated delay in milliseconds, 0 to fire on the first tick */
+  uint32_t ticks;            /**< periods accounted by the next call (coalesce policy) */
+  uint32_t fired;            /**< number of calls of the callback */
+  uint32_t overruns;         /**< number of times the next deadline was already past */
+  uint32_t missed;           /**< number of periods skipped or coalesced */
+  uint32_t max_lateness;     /**< maximum delay of a call from its deadline in microseconds */
+  uint32_t coalesced;        /**< number of calls which shared their wake-up thanks to the slack */
+} jerryxx_timer_t;
+
+static jerryxx_timer_t jerryxx_timer_pool[JERRYXX_TIMER_POOL_SIZE];
+static jerryxx_timer_link_t jerryxx_timer_wheel[JERRYXX_TIMER_WHEEL_LEVELS][JERRYXX_TIMER_WHEEL_SLOTS];
+static uint64_t jerryxx_timer_wheel_bitmap[JERRYXX_TIMER_WHEEL_LEVELS];
+static uint64_t jerryxx_timer_wheel_now = 0;
+static jerryxx_timer_link_t jerryxx_timer_due;
+static jerryxx_timer_link_t jerryxx_timer_batch;
+static jerryxx_timer_link_t jerryxx_idle_queue;
+static jerryxx_timer_link_t jerryxx_idle_batch;
+static jerryxx_timer_link_t jerryxx_timer_free;
+static uint32_t jerryxx_timer_armed_count = 0;
+static bool jerryxx_timer_wheel_ready = false;
+
+/**
+ * Event flag which wakes up the idle event loop.
+ */
+#define JERRYXX_EVENT_FLAG_WAKE (1UL << 0)
+
+static rtos::EventFlags jerryxx_event_flags;
+static jerryxx_idle_stats_t jerryxx_idle_stats;
+
+/**
+ * Telemetry of the event loop, jerryxx_loop_backlog counts the callbacks left in the running pass.
+ */
+const uint32_t jerryxx_lateness_bounds[JERRYXX_LATENESS_BUCKETS] = {250, 500, 1000, 2000, 5000, 10000, 50000, UINT32_MAX};
+
+static jerryxx_loop_stats_t jerryxx_loop_stats;
+static uint32_t jerryxx_loop_backlog = 0;
 
 /**
- * Run JavaScript scheduler (user for switch setTimeout and setInterval threads).
+ * Read the monotonic microseconds clock used by the scheduler.
  *
- * @return true - if the operation was successful,
- *         false - otherwise.
+ * @return current time in microseconds
  */
-bool jerryxx_scheduler_yield(void)
+static uint64_t
+jerryxx_clock_us(void)
 {
-  yield();
-} /* jerryxx_scheduler_yield */
+  return ticker_read_us(get_us_ticker_data());
+} /* jerryxx_clock_us */
+
+/**
+ * Registers of a GPIO, written directly so the write is atomic and safe from interrupts.
+ */
+typedef struct
+{
+  GPIO_TypeDef *port_p; /**< port of the pin */
+  uint32_t mask;        /**< bit of the pin in the port */
+} jerryxx_gpio_t;
+
+extern "C" GPIO_TypeDef *Set_GPIO_Clock(uint32_t port_idx);
 
 /**
- * Cleanup scheduler thread in state Deleted.
+ * Resolve the registers of an Arduino pin. The pin keeps the mode set by pinMode.
  *
- * @return true - if the operation was successful,
+ * @return true - if the pin is a GPIO,
  *         false - otherwise.
  */
-bool jerryxx_cleanup_scheduler_map(void)
+static bool
+jerryxx_gpio_from_pin(uint32_t pin,            /**< Arduino pin */
+                      jerryxx_gpio_t *gpio_p) /**< [out] registers of the pin */
 {
-  std::unordered_map<int, rtos::Thread *>::const_iterator it;
-  for (it = jerryxx_scheduler_threads_map.begin(); it != jerryxx_scheduler_threads_map.end(); it++)
+  if (pin >= PINS_COUNT)
   {
-    int thid = it->first;
-    rtos::Thread *thread = it->second;
+    return false;
+  }
 
-    if (thread->get_state() == rtos::Thread::Deleted)
-    {
-      thread->terminate();
-      jerryxx_scheduler_threads_mutex.lock();
-      jerryxx_scheduler_threads_map.erase(thid);
-      jerryxx_scheduler_threads_mutex.unlock();
-    }
+  PinName name = digitalPinToPinName((pin_size_t)pin);
+  if (name == NC)
+  {
+    return false;
   }
-} /* jerryxx_cleanup_scheduler_map */
+
+  gpio_p->port_p = Set_GPIO_Clock(STM_PORT(name));
+  gpio_p->mask = 1UL << STM_PIN(name);
+
+  return true;
+} /* jerryxx_gpio_from_pin */
 
 /**
- * Register a JavaScript property in the global object.
- *
- * @return true - if the operation was successful,
- *         false - otherwise.
+ * Drive a GPIO through its bit set/reset register.
  */
-bool jerryxx_register_global_property(const char *name_p,  /**< name of the property */
-                                      jerry_value_t value, /**< value of the property */
-                                      bool free_value)     /**< take ownership of the value */
+static inline void
+jerryxx_gpio_write(const jerryxx_gpio_t *gpio_p, /**< registers of the pin */
+                   uint32_t value)               /**< HIGH or LOW */
 {
-  jerry_value_t global_obj_val = jerry_current_realm();
-  jerry_value_t property_name_val = jerry_string_sz(name_p);
+  gpio_p->port_p->BSRR = value ? gpio_p->mask : gpio_p->mask << 16;
+} /* jerryxx_gpio_write */
 
-  jerry_value_t result_val = jerry_object_set(global_obj_val, property_name_val, value);
-  bool result = jerry_value_is_true(result_val);
+/**
+ * Read a GPIO through its input data register.
+ *
+ * @return HIGH or LOW
+ */
+static inline uint32_t
+jerryxx_gpio_read(const jerryxx_gpio_t *gpio_p) /**< registers of the pin */
+{
+  return (gpio_p->port_p->IDR & gpio_p->mask) ? HIGH : LOW;
+} /* jerryxx_gpio_read */
 
-  jerry_value_free(result_val);
-  jerry_value_free(property_name_val);
-  jerry_value_free(global_obj_val);
+/**
+ * EXTI lines claimed by attachInterrupt and the native drivers. A line is
+ * shared by the pins of the same number on all the ports, and only one of
+ * them can interrupt: a second InterruptIn would silently take the line over.
+ */
+static uint32_t jerryxx_exti_claimed = 0;
 
-  if (free_value)
-  {
-    jerry_value_free(value);
-  }
+/**
+ * Get the EXTI line of a pin as a mask.
+ *
+ * @return bit of the line - if the pin is a GPIO,
+ *         0 - otherwise.
+ */
+static inline uint32_t
+jerryxx_exti_mask(uint32_t pin) /**< Arduino pin */
+{
+  PinName name = pin < PINS_COUNT ? digitalPinToPinName((pin_size_t)pin) : NC;
 
-  return result;
-} /* jerryxx_register_global_property */
+  return name != NC ? 1UL << STM_PIN(name) : 0;
+} /* jerryxx_exti_mask */
 
 /**
- * Register Extra API into JavaScript global object.
+ * Check whether the EXTI line of a pin is free.
  *
- * @return true - if the operation was successful,
+ * @return true - if no pin interrupts through the line,
  *         false - otherwise.
  */
-bool jerryxx_register_extra_api(void)
+static inline bool
+jerryxx_exti_is_free(uint32_t pin) /**< Arduino pin */
 {
-  bool ret = false;
+  return (jerryxx_exti_claimed & jerryxx_exti_mask(pin)) == 0;
+} /* jerryxx_exti_is_free */
 
-  /* Register the print function in the global object */
-  JERRYXX_BOOL_CHK(jerryx_register_global("print", jerryx_handler_print));
+/**
+ * Claim the EXTI line of a pin, checked free by the caller.
+ */
+static inline void
+jerryxx_exti_claim(uint32_t pin) /**< Arduino pin */
+{
+  jerryxx_exti_claimed |= jerryxx_exti_mask(pin);
+} /* jerryxx_exti_claim */
 
-  /* Register the setTimeout function in the global object */
-  JERRYXX_BOOL_CHK(jerryx_register_global("setTimeout", js_set_timeout));
+/**
+ * Give the EXTI line of a pin back.
+ */
+static inline void
+jerryxx_exti_release(uint32_t pin) /**< Arduino pin */
+{
+  jerryxx_exti_claimed &= ~jerryxx_exti_mask(pin);
+} /* jerryxx_exti_release */
 
-  /* Register the clearTimeout function in the global object */
-  JERRYXX_BOOL_CHK(jerryx_register_global("clearTimeout", js_clear_timeout));
+/**
+ * Users of a timer. The Encoder takes the whole timer, the PwmOut channels of
+ * a timer share it with each other.
+ */
+typedef enum
+{
+  JERRYXX_TIM_FREE,    /**< not reprogrammed by a native driver */
+  JERRYXX_TIM_ENCODER, /**< counting a quadrature signal */
+  JERRYXX_TIM_PWM,     /**< driving open PwmOut channels */
+} jerryxx_tim_user_t;
 
-  /* Register the setInterval function in the global object */
-  JERRYXX_BOOL_CHK(jerryx_register_global("setInterval", js_set_interval));
+/**
+ * Timers which the native drivers can reprogram.
+ */
+static TIM_TypeDef *const jerryxx_tims[] = {
+#if defined(TIM1)
+    TIM1,
+#endif /* defined(TIM1) */
+#if defined(TIM2)
+    TIM2,
+#endif /* defined(TIM2) */
+#if defined(TIM3)
+    TIM3,
+#endif /* defined(TIM3) */
+#if defined(TIM4)
+    TIM4,
+#endif /* defined(TIM4) */
+#if defined(TIM5)
+    TIM5,
+#endif /* defined(TIM5) */
+#if defined(TIM8)
+    TIM8,
+#endif /* defined(TIM8) */
+#if defined(TIM12)
+    TIM12,
+#endif /* defined(TIM12) */
+#if defined(TIM13)
+    TIM13,
+#endif /* defined(TIM13) */
+#if defined(TIM14)
+    TIM14,
+#endif /* defined(TIM14) */
+#if defined(TIM15)
+    TIM15,
+#endif /* defined(TIM15) */
+#if defined(TIM16)
+    TIM16,
+#endif /* defined(TIM16) */
+#if defined(TIM17)
+    TIM17,
+#endif /* defined(TIM17) */
+};
 
-  /* Register the clearInterval function in the global object */
-  JERRYXX_BOOL_CHK(jerryx_register_global("clearInterval", js_clear_interval));
+/**
+ * Current user of each timer of jerryxx_tims.
+ */
+static uint8_t jerryxx_tim_users[JERRYXX_ARRAY_SIZE(jerryxx_tims)];
 
-cleanup:
-  return ret;
-} /* jerryxx_register_extra_api */
+/**
+ * Get the index of a timer in jerryxx_tims.
+ *
+ * @return index - if the timer is known,
+ *         -1 - otherwise.
+ */
+static int32_t
+jerryxx_tim_index(const TIM_TypeDef *tim_p) /**< timer */
+{
+  for (uint32_t idx = 0; idx < JERRYXX_ARRAY_SIZE(jerryxx_tims); idx++)
+  {
+    if (jerryxx_tims[idx] == tim_p)
+    {
+      return (int32_t)idx;
+    }
+  }
+
+  return -1;
+} /* jerryxx_tim_index */
 
 /**
- * Javascript: setTimeout
+ * Get the user of a timer.
+ *
+ * @return jerryxx_tim_user_t
  */
-JERRYXX_DECLARE_FUNCTION(set_timeout)
+static uint8_t
+jerryxx_tim_user(const TIM_TypeDef *tim_p) /**< timer */
 {
-  JERRYX_UNUSED(call_info_p);
-  jerry_value_t callback_fn = 0;
-  uint32_t delay_time = 0;
+  int32_t idx = jerryxx_tim_index(tim_p);
 
-  const jerryx_arg_t mapping[] =
-      {
-          jerryx_arg_function(&callback_fn, JERRYX_ARG_REQUIRED),
-          jerryx_arg_uint32(&delay_time, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_OPTIONAL),
-      };
+  return idx >= 0 ? jerryxx_tim_users[idx] : (uint8_t)JERRYXX_TIM_FREE;
+} /* jerryxx_tim_user */
 
-  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
-  if (jerry_value_is_exception(rv))
+/**
+ * Record the user of a timer, JERRYXX_TIM_FREE to give it back.
+ */
+static void
+jerryxx_tim_set_user(const TIM_TypeDef *tim_p, /**< timer */
+                     jerryxx_tim_user_t user)  /**< new user */
+{
+  int32_t idx = jerryxx_tim_index(tim_p);
+
+  if (idx >= 0)
   {
-    return rv;
+    jerryxx_tim_users[idx] = (uint8_t)user;
   }
+} /* jerryxx_tim_set_user */
 
-  jerryxx_cleanup_scheduler_map();
+/**
+ * Get the frequency of the clock counted by a timer.
+ *
+ * @return frequency in hertz
+ */
+static uint32_t
+jerryxx_tim_clock(const TIM_TypeDef *tim_p) /**< timer */
+{
+  RCC_ClkInitTypeDef clock_init;
+  uint32_t flash_latency = 0;
+  HAL_RCC_GetClockConfig(&clock_init, &flash_latency);
 
-  if (jerryxx_scheduler_threads_map.size() < JERRYXX_MAX_THREADS_NUMBER)
+  /* A timer runs at twice the clock of its APB bus when the bus is divided */
+  if ((uintptr_t)tim_p >= D2_APB2PERIPH_BASE)
   {
-    rtos::Thread *thread = new rtos::Thread;
-    thread->start([callback_fn, delay_time](void) -> void
-                  {
-      jerry_value_t callback_fn_copy = jerry_value_copy (callback_fn);
-
-      rtos::ThisThread::sleep_for(abs (delay_time));
-
-      jerry_value_t global_obj_val = jerry_current_realm ();
-      jerry_value_t result_val = jerry_call (callback_fn_copy, global_obj_val, NULL, 0);
-      jerry_value_free (result_val);
-      jerry_value_free (global_obj_val);
-      jerry_value_free (callback_fn_copy); });
-    int idx = (int)thread->get_id();
+    return HAL_RCC_GetPCLK2Freq() * (clock_init.APB2CLKDivider == RCC_APB2_DIV1 ? 1 : 2);
+  }
 
-    jerryxx_scheduler_threads_mutex.lock();
-    jerryxx_scheduler_threads_map.insert(std::make_pair(idx, thread));
-    jerryxx_scheduler_threads_mutex.unlock();
+  return HAL_RCC_GetPCLK1Freq() * (clock_init.APB1CLKDivider == RCC_APB1_DIV1 ? 1 : 2);
+} /* jerryxx_tim_clock */
 
-    return jerry_number(idx);
-  }
+/**
+ * Number of GPIO ports, from PortA to PortK.
+ */
+#define JERRYXX_GPIO_PORT_COUNT (PortK + 1)
 
-  return jerry_throw_sz(JERRY_ERROR_RANGE, "No scheduler slot free found.");
-} /* js_set_timeout */
+/**
+ * Largest number of pins of a PinGroup, one per bit of its value.
+ */
+#define JERRYXX_PIN_GROUP_MAX 32
 
 /**
- * Javascript: clearTimeout
+ * Pins driven and read together, with one register access per port.
  */
-JERRYXX_DECLARE_FUNCTION(clear_timeout)
+typedef struct
 {
-  JERRYX_UNUSED(call_info_p);
-  uint32_t timeout_id = 0;
+  jerryxx_gpio_t ports[JERRYXX_PIN_GROUP_MAX]; /**< ports of the group, with the mask of all their pins */
+  uint8_t port_of[JERRYXX_PIN_GROUP_MAX];      /**< index in ports of each pin */
+  uint32_t masks[JERRYXX_PIN_GROUP_MAX];       /**< bit of each pin in its port */
+  uint32_t port_count;                         /**< number of ports */
+  uint32_t pin_count;                          /**< number of pins */
+} jerryxx_pin_group_t;
 
-  const jerryx_arg_t mapping[] =
-      {
-          jerryx_arg_uint32(&timeout_id, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
-      };
+/**
+ * Add a pin to a group, as the next bit of its value.
+ *
+ * @return true - if the pin is a GPIO not already in the group,
+ *         false - otherwise.
+ */
+static bool
+jerryxx_pin_group_add(jerryxx_pin_group_t *group_p, /**< group */
+                      uint32_t pin)                 /**< Arduino pin */
+{
+  jerryxx_gpio_t gpio;
 
-  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
-  if (jerry_value_is_exception(rv))
+  if (group_p->pin_count >= JERRYXX_PIN_GROUP_MAX || !jerryxx_gpio_from_pin(pin, &gpio))
   {
-    return rv;
+    return false;
   }
 
-  std::unordered_map<int, rtos::Thread *>::const_iterator got = jerryxx_scheduler_threads_map.find(timeout_id);
-  if (got != jerryxx_scheduler_threads_map.end())
+  uint32_t port = 0;
+
+  while (port < group_p->port_count && group_p->ports[port].port_p != gpio.port_p)
   {
-    int idx = got->first;
-    rtos::Thread *thread = got->second;
-    thread->terminate();
+    port++;
+  }
 
-    jerryxx_scheduler_threads_mutex.lock();
-    jerryxx_scheduler_threads_map.erase(idx);
-    jerryxx_scheduler_threads_mutex.unlock();
+  if (port == group_p->port_count)
+  {
+    group_p->ports[port].port_p = gpio.port_p;
+    group_p->ports[port].mask = 0;
+    group_p->port_count++;
+  }
+  else if (group_p->ports[port].mask & gpio.mask)
+  {
+    return false;
   }
 
-  jerryxx_cleanup_scheduler_map();
+  group_p->ports[port].mask |= gpio.mask;
+  group_p->port_of[group_p->pin_count] = (uint8_t)port;
+  group_p->masks[group_p->pin_count] = gpio.mask;
+  group_p->pin_count++;
 
-  return jerry_undefined();
-} /* js_clear_timeout */
+  return true;
+} /* jerryxx_pin_group_add */
 
 /**
- * Javascript: setInterval
+ * Drive the pins of a group, bit n of the value to the pin n. The pins of a port
+ * change together through one write of its bit set/reset register.
  */
-JERRYXX_DECLARE_FUNCTION(set_interval)
+static void
+jerryxx_pin_group_write(const jerryxx_pin_group_t *group_p, /**< group */
+                        uint32_t bits)                      /**< value */
 {
-  JERRYX_UNUSED(call_info_p);
-  jerry_value_t callback_fn = 0;
-  uint32_t delay_time = 0;
+  uint32_t set[JERRYXX_PIN_GROUP_MAX] = {0};
 
-  const jerryx_arg_t mapping[] =
-      {
-          jerryx_arg_function(&callback_fn, JERRYX_ARG_REQUIRED),
-          jerryx_arg_uint32(&delay_time, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_OPTIONAL),
-      };
+  for (uint32_t idx = 0; idx < group_p->pin_count; idx++)
+  {
+    if (bits & (1UL << idx))
+    {
+      set[group_p->port_of[idx]] |= group_p->masks[idx];
+    }
+  }
 
-  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
-  if (jerry_value_is_exception(rv))
+  for (uint32_t port = 0; port < group_p->port_count; port++)
   {
-    return rv;
+    uint32_t mask = group_p->ports[port].mask;
+    group_p->ports[port].port_p->BSRR = set[port] | ((mask & ~set[port]) << 16);
   }
+} /* jerryxx_pin_group_write */
+
+/**
+ * Read the pins of a group, with one read of the input data register per port.
+ *
+ * @return value, bit n from the pin n
+ */
+static uint32_t
+jerryxx_pin_group_read(const jerryxx_pin_group_t *group_p) /**< group */
+{
+  uint32_t levels[JERRYXX_PIN_GROUP_MAX];
+  uint32_t bits = 0;
 
-  jerryxx_cleanup_scheduler_map();
+  for (uint32_t port = 0; port < group_p->port_count; port++)
+  {
+    levels[port] = group_p->ports[port].port_p->IDR;
+  }
 
-  if (jerryxx_scheduler_threads_map.size() < JERRYXX_MAX_THREADS_NUMBER)
+  for (uint32_t idx = 0; idx < group_p->pin_count; idx++)
   {
-    rtos::Thread *thread = new rtos::Thread;
-    thread->start([callback_fn, delay_time](void) -> void
-                  {
-      while(true)
-      {
-        jerry_value_t callback_fn_copy = jerry_value_copy (callback_fn);
+    if (levels[group_p->port_of[idx]] & group_p->masks[idx])
+    {
+      bits |= 1UL << idx;
+    }
+  }
 
-        rtos::ThisThread::sleep_for(abs (delay_time));
+  return bits;
+} /* jerryxx_pin_group_read */
 
-        jerry_value_t global_obj_val = jerry_current_realm ();
-        jerry_value_t result_val = jerry_call (callback_fn_copy, global_obj_val, NULL, 0);
-        jerry_value_free (result_val);
-        jerry_value_free (global_obj_val);
-        jerry_value_free (callback_fn_copy);
-      } });
-    int idx = (int)thread->get_id();
+/**
+ * Wait half a period of the clock of shiftOut and shiftIn on a buffer.
+ */
+static inline void
+jerryxx_shift_wait(void)
+{
+#if JERRYXX_SHIFT_HALF_PERIOD_NS > 0
+  wait_ns(JERRYXX_SHIFT_HALF_PERIOD_NS);
+#endif /* JERRYXX_SHIFT_HALF_PERIOD_NS > 0 */
+} /* jerryxx_shift_wait */
 
-    jerryxx_scheduler_threads_mutex.lock();
-    jerryxx_scheduler_threads_map.insert(std::make_pair(idx, thread));
-    jerryxx_scheduler_threads_mutex.unlock();
+/**
+ * Shift out a buffer a bit at a time, as shiftOut does for each byte: the data is
+ * set and then the clock pulsed high.
+ */
+static void
+jerryxx_shift_out_buffer(const jerryxx_gpio_t *data_p,  /**< data pin */
+                         const jerryxx_gpio_t *clock_p, /**< clock pin */
+                         uint32_t bit_order,            /**< MSBFIRST or LSBFIRST */
+                         const uint8_t *buffer_p,       /**< bytes */
+                         uint32_t length)               /**< number of bytes */
+{
+  for (uint32_t idx = 0; idx < length; idx++)
+  {
+    uint8_t value = buffer_p[idx];
 
-    return jerry_number(idx);
+    for (uint32_t bit = 0; bit < 8; bit++)
+    {
+      uint32_t level = bit_order == MSBFIRST ? (value >> (7 - bit)) & 1 : (value >> bit) & 1;
+      jerryxx_gpio_write(data_p, level);
+      jerryxx_shift_wait();
+      jerryxx_gpio_write(clock_p, HIGH);
+      jerryxx_shift_wait();
+      jerryxx_gpio_write(clock_p, LOW);
+    }
   }
-
-  return jerry_throw_sz(JERRY_ERROR_RANGE, "No scheduler slot free found.");
-} /* js_set_interval */
+} /* jerryxx_shift_out_buffer */
 
 /**
- * Javascript: clearInterval
+ * Shift in a buffer a bit at a time, as shiftIn does for each byte: the clock is
+ * pulsed high and the data read before it goes low.
  */
-JERRYXX_DECLARE_FUNCTION(clear_interval)
+static void
+jerryxx_shift_in_buffer(const jerryxx_gpio_t *data_p,  /**< data pin */
+                        const jerryxx_gpio_t *clock_p, /**< clock pin */
+                        uint32_t bit_order,            /**< MSBFIRST or LSBFIRST */
+                        uint8_t *buffer_p,             /**< [out] bytes */
+                        uint32_t length)               /**< number of bytes */
 {
-  JERRYX_UNUSED(call_info_p);
-  uint32_t interval_id = 0;
+  for (uint32_t idx = 0; idx < length; idx++)
+  {
+    uint8_t value = 0;
 
-  const jerryx_arg_t mapping[] =
-      {
-          jerryx_arg_uint32(&interval_id, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
-      };
+    for (uint32_t bit = 0; bit < 8; bit++)
+    {
+      jerryxx_gpio_write(clock_p, HIGH);
+      jerryxx_shift_wait();
+      uint32_t level = jerryxx_gpio_read(data_p);
+      value |= bit_order == MSBFIRST ? level << (7 - bit) : level << bit;
+      jerryxx_gpio_write(clock_p, LOW);
+      jerryxx_shift_wait();
+    }
 
-  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
-  if (jerry_value_is_exception(rv))
-  {
-    return rv;
+    buffer_p[idx] = value;
   }
+} /* jerryxx_shift_in_buffer */
 
-  std::unordered_map<int, rtos::Thread *>::const_iterator got = jerryxx_scheduler_threads_map.find(interval_id);
-  if (got != jerryxx_scheduler_threads_map.end())
+/**
+ * Get the elements of a typed array of a given type, without copy.
+ *
+ * @return pointer to the elements - if the value is a typed array of the type,
+ *         NULL - otherwise.
+ */
+static void *
+jerryxx_typedarray_data(const jerry_value_t value,    /**< value */
+                        jerry_typedarray_type_t type, /**< expected type */
+                        jerry_length_t *count_p)      /**< [out] number of elements */
+{
+  if (!jerry_value_is_typedarray(value) || jerry_typedarray_type(value) != type)
   {
-    int idx = got->first;
-    rtos::Thread *thread = got->second;
-    thread->terminate();
-
-    jerryxx_scheduler_threads_mutex.lock();
-    jerryxx_scheduler_threads_map.erase(idx);
-    jerryxx_scheduler_threads_mutex.unlock();
+    return NULL;
   }
 
-  jerryxx_cleanup_scheduler_map();
+  jerry_length_t offset = 0;
+  jerry_length_t byte_length = 0;
+  jerry_value_t buffer = jerry_typedarray_buffer(value, &offset, &byte_length);
+  uint8_t *data_p = jerry_arraybuffer_data(buffer);
+  jerry_value_free(buffer);
 
-  return jerry_undefined();
-} /* js_clear_interval */
+  *count_p = jerry_typedarray_length(value);
+  return data_p != NULL ? data_p + offset : NULL;
+} /* jerryxx_typedarray_data */
 
-/*******************************************************************************
- *                                  Arduino API                                *
- ******************************************************************************/
+/**
+ * Initialize an empty list.
+ */
+static inline void
+jerryxx_timer_list_init(jerryxx_timer_link_t *list_p) /**< list head */
+{
+  list_p->next_p = list_p;
+  list_p->prev_p = list_p;
+} /* jerryxx_timer_list_init */
 
 /**
- * Register Arduino API into JavaScript global object.
+ * Check whether a list is empty.
  *
- * @return true - if the operation was successful,
+ * @return true - if the list is empty,
  *         false - otherwise.
  */
-bool jerryxx_register_arduino_api(void)
+static inline bool
+jerryxx_timer_list_is_empty(const jerryxx_timer_link_t *list_p) /**< list head */
 {
-  bool ret = false;
-
-  /* Register Constants in the global object */
+  return list_p->next_p == list_p;
+} /* jerryxx_timer_list_is_empty */
 
-  /* Bit Order */
+/**
+ * Append an element at the end of a list.
+ */
+static inline void
+jerryxx_timer_list_append(jerryxx_timer_link_t *list_p, /**< list head */
+                          jerryxx_timer_link_t *link_p) /**< element to append */
+{
+  link_p->next_p = list_p;
+  link_p->prev_p = list_p->prev_p;
+  list_p->prev_p->next_p = link_p;
+  list_p->prev_p = link_p;
+} /* jerryxx_timer_list_append */
+
+/**
+ * Remove an element from the list which contains it.
+ */
+static inline void
+jerryxx_timer_list_remove(jerryxx_timer_link_t *link_p) /**< element to remove */
+{
+  link_p->prev_p->next_p = link_p->next_p;
+  link_p->next_p->prev_p = link_p->prev_p;
+  link_p->next_p = link_p;
+  link_p->prev_p = link_p;
+} /* jerryxx_timer_list_remove */
+
+/**
+ * Move all the elements of a list at the end of another one.
+ */
+static inline void
+jerryxx_timer_list_splice(jerryxx_timer_link_t *list_p,   /**< destination list head */
+                          jerryxx_timer_link_t *source_p) /**< source list head, emptied */
+{
+  if (jerryxx_timer_list_is_empty(source_p))
+  {
+    return;
+  }
+
+  source_p->next_p->prev_p = list_p->prev_p;
+  list_p->prev_p->next_p = source_p->next_p;
+  source_p->prev_p->next_p = list_p;
+  list_p->prev_p = source_p->prev_p;
+  jerryxx_timer_list_init(source_p);
+} /* jerryxx_timer_list_splice */
+
+/**
+ * Initialize the wheel and the pool of timers on first use.
+ */
+static void
+jerryxx_timer_wheel_init(void)
+{
+  if (jerryxx_timer_wheel_ready)
+  {
+    return;
+  }
+
+  for (uint32_t level = 0; level < JERRYXX_TIMER_WHEEL_LEVELS; level++)
+  {
+    for (uint32_t slot = 0; slot < JERRYXX_TIMER_WHEEL_SLOTS; slot++)
+    {
+      jerryxx_timer_list_init(&jerryxx_timer_wheel[level][slot]);
+    }
+
+    jerryxx_timer_wheel_bitmap[level] = 0;
+  }
+
+  jerryxx_timer_list_init(&jerryxx_timer_due);
+  jerryxx_timer_list_init(&jerryxx_timer_batch);
+  jerryxx_timer_list_init(&jerryxx_idle_queue);
+  jerryxx_timer_list_init(&jerryxx_idle_batch);
+  jerryxx_timer_list_init(&jerryxx_timer_free);
+
+  for (uint32_t idx = 0; idx < JERRYXX_TIMER_POOL_SIZE; idx++)
+  {
+    jerryxx_timer_t *timer_p = &jerryxx_timer_pool[idx];
+
+    /* Generation starts from 1 so no identifier is ever 0 */
+    timer_p->generation = 1;
+    timer_p->state = JERRYXX_TIMER_FREE;
+    timer_p->slot = JERRYXX_TIMER_SLOT_NONE;
+    jerryxx_timer_list_append(&jerryxx_timer_free, &timer_p->link);
+  }
+
+  jerryxx_timer_wheel_now = jerryxx_clock_us() / 1000;
+  jerryxx_timer_armed_count = 0;
+  jerryxx_timer_wheel_ready = true;
+} /* jerryxx_timer_wheel_init */
+
+/**
+ * Build the identifier of a timer: generation in the high half, pool index in the low half.
+ *
+ * @return identifier of the timer
+ */
+static inline uint32_t
+jerryxx_timer_id(const jerryxx_timer_t *timer_p) /**< timer */
+{
+  return ((uint32_t)timer_p->generation << 16) | (uint32_t)(timer_p - jerryxx_timer_pool);
+} /* jerryxx_timer_id */
+
+/**
+ * Find the timer referenced by an identifier.
+ *
+ * @return pointer to the timer - if the identifier is still valid,
+ *         NULL - otherwise.
+ */
+static jerryxx_timer_t *
+jerryxx_timer_from_id(uint32_t id) /**< identifier of the timer */
+{
+  uint32_t idx = id & 0xFFFF;
+
+  if (!jerryxx_timer_wheel_ready || idx >= JERRYXX_TIMER_POOL_SIZE)
+  {
+    return NULL;
+  }
+
+  jerryxx_timer_t *timer_p = &jerryxx_timer_pool[idx];
+
+  if (timer_p->state == JERRYXX_TIMER_FREE || timer_p->generation != (id >> 16))
+  {
+    return NULL;
+  }
+
+  return timer_p;
+} /* jerryxx_timer_from_id */
+
+/**
+ * Link a timer into the wheel slot matching its deadline, or into the due list if already expired.
+ */
+static void
+jerryxx_timer_arm(jerryxx_timer_t *timer_p) /**< timer to arm */
+{
+  uint64_t expires = (timer_p->deadline + 999) / 1000;
+  uint64_t limit = (timer_p->deadline / 1000) + timer_p->slack;
+
+  /* Round up to the coarsest tick of the slack window: overlapping windows meet in one slot */
+  timer_p->aligned = false;
+  timer_p->shared = false;
+
+  if (limit > expires)
+  {
+    uint32_t bit = 63 - __builtin_clzll(expires ^ limit);
+    uint64_t rounded = limit & ~((1ull << bit) - 1);
+    timer_p->aligned = rounded != expires;
+    expires = rounded;
+  }
+
+  if (expires <= jerryxx_timer_wheel_now)
+  {
+    timer_p->state = JERRYXX_TIMER_DUE;
+    timer_p->slot = JERRYXX_TIMER_SLOT_NONE;
+    jerryxx_timer_list_append(&jerryxx_timer_due, &timer_p->link);
+    return;
+  }
+
+  uint64_t delta = expires - jerryxx_timer_wheel_now;
+  uint32_t level = 0;
+
+  while (level < JERRYXX_TIMER_WHEEL_LEVELS - 1 && delta >= (1ull << (JERRYXX_TIMER_WHEEL_BITS * (level + 1))))
+  {
+    level++;
+  }
+
+  if (delta >= (1ull << (JERRYXX_TIMER_WHEEL_BITS * JERRYXX_TIMER_WHEEL_LEVELS)))
+  {
+    /* Out of range, park it in the farthest slot: it will be re-armed when cascaded */
+    expires = jerryxx_timer_wheel_now + (1ull << (JERRYXX_TIMER_WHEEL_BITS * JERRYXX_TIMER_WHEEL_LEVELS)) - 1;
+  }
+
+  uint32_t slot = (uint32_t)(expires >> (JERRYXX_TIMER_WHEEL_BITS * level)) & JERRYXX_TIMER_WHEEL_MASK;
+
+  timer_p->state = JERRYXX_TIMER_ARMED;
+  timer_p->slot = (uint16_t)(level * JERRYXX_TIMER_WHEEL_SLOTS + slot);
+  jerryxx_timer_list_append(&jerryxx_timer_wheel[level][slot], &timer_p->link);
+  jerryxx_timer_wheel_bitmap[level] |= (1ull << slot);
+} /* jerryxx_timer_arm */
+
+/**
+ * Unlink a timer from the wheel slot or the list which contains it.
+ */
+static void
+jerryxx_timer_disarm(jerryxx_timer_t *timer_p) /**< timer to disarm */
+{
+  jerryxx_timer_list_remove(&timer_p->link);
+
+  if (timer_p->slot != JERRYXX_TIMER_SLOT_NONE)
+  {
+    uint32_t level = timer_p->slot / JERRYXX_TIMER_WHEEL_SLOTS;
+    uint32_t slot = timer_p->slot % JERRYXX_TIMER_WHEEL_SLOTS;
+
+    if (jerryxx_timer_list_is_empty(&jerryxx_timer_wheel[level][slot]))
+    {
+      jerryxx_timer_wheel_bitmap[level] &= ~(1ull << slot);
+    }
+
+    timer_p->slot = JERRYXX_TIMER_SLOT_NONE;
+  }
+} /* jerryxx_timer_disarm */
+
+/**
+ * Re-arm all the timers of a slot, called when the lower levels wrap around.
+ */
+static void
+jerryxx_timer_wheel_cascade(uint32_t level, /**< level of the slot */
+                            uint32_t slot)  /**< index of the slot */
+{
+  jerryxx_timer_link_t pending;
+  jerryxx_timer_list_init(&pending);
+  jerryxx_timer_list_splice(&pending, &jerryxx_timer_wheel[level][slot]);
+  jerryxx_timer_wheel_bitmap[level] &= ~(1ull << slot);
+
+  while (!jerryxx_timer_list_is_empty(&pending))
+  {
+    jerryxx_timer_t *timer_p = (jerryxx_timer_t *)pending.next_p;
+    jerryxx_timer_list_remove(&timer_p->link);
+    jerryxx_timer_arm(timer_p);
+  }
+} /* jerryxx_timer_wheel_cascade */
+
+/**
+ * Advance the wheel up to a tick moving the expired timers into the due list.
+ * Runs of empty slots are skipped using the occupancy bitmaps.
+ */
+static void
+jerryxx_timer_wheel_advance(uint64_t target) /**< tick to reach */
+{
+  while (jerryxx_timer_wheel_now < target)
+  {
+    if (jerryxx_timer_wheel_bitmap[0] == 0)
+    {
+      uint32_t level = 1;
+
+      while (level < JERRYXX_TIMER_WHEEL_LEVELS && jerryxx_timer_wheel_bitmap[level] == 0)
+      {
+        level++;
+      }
+
+      if (level == JERRYXX_TIMER_WHEEL_LEVELS)
+      {
+        jerryxx_timer_wheel_now = target;
+        return;
+      }
+
+      /* Nothing can expire before the next cascade of the first non-empty level */
+      uint32_t shift = JERRYXX_TIMER_WHEEL_BITS * level;
+      uint64_t boundary = ((jerryxx_timer_wheel_now >> shift) + 1) << shift;
+
+      if (boundary > target)
+      {
+        jerryxx_timer_wheel_now = target;
+        return;
+      }
+
+      jerryxx_timer_wheel_now = boundary - 1;
+    }
+
+    jerryxx_timer_wheel_now++;
+    jerryxx_timer_link_t *last_p = jerryxx_timer_due.prev_p;
+
+    for (uint32_t level = 1; level < JERRYXX_TIMER_WHEEL_LEVELS; level++)
+    {
+      if (((jerryxx_timer_wheel_now >> (JERRYXX_TIMER_WHEEL_BITS * (level - 1))) & JERRYXX_TIMER_WHEEL_MASK) != 0)
+      {
+        break;
+      }
+
+      jerryxx_timer_wheel_cascade(level, (uint32_t)(jerryxx_timer_wheel_now >> (JERRYXX_TIMER_WHEEL_BITS * level)) & JERRYXX_TIMER_WHEEL_MASK);
+    }
+
+    uint32_t slot = (uint32_t)jerryxx_timer_wheel_now & JERRYXX_TIMER_WHEEL_MASK;
+    jerryxx_timer_link_t *slot_p = &jerryxx_timer_wheel[0][slot];
+
+    for (jerryxx_timer_link_t *link_p = slot_p->next_p; link_p != slot_p; link_p = link_p->next_p)
+    {
+      jerryxx_timer_t *timer_p = (jerryxx_timer_t *)link_p;
+      timer_p->state = JERRYXX_TIMER_DUE;
+      timer_p->slot = JERRYXX_TIMER_SLOT_NONE;
+    }
+
+    jerryxx_timer_list_splice(&jerryxx_timer_due, slot_p);
+    jerryxx_timer_wheel_bitmap[0] &= ~(1ull << slot);
+
+    /* Cascaded or taken from the slot, the timers after last_p all expire at this tick */
+    bool shared = last_p->next_p != &jerryxx_timer_due && last_p->next_p->next_p != &jerryxx_timer_due;
+
+    for (jerryxx_timer_link_t *link_p = last_p->next_p; link_p != &jerryxx_timer_due; link_p = link_p->next_p)
+    {
+      ((jerryxx_timer_t *)link_p)->shared = shared;
+    }
+  }
+} /* jerryxx_timer_wheel_advance */
+
+/**
+ * Compute the first tick at which the wheel may have something to do.
+ * Higher levels report the tick of their next cascade, which is a lower bound.
+ *
+ * @return tick of the next expiration or cascade,
+ *         UINT64_MAX - if no timer is armed.
+ */
+static uint64_t
+jerryxx_timer_wheel_next_tick(void)
+{
+  if (!jerryxx_timer_list_is_empty(&jerryxx_timer_due))
+  {
+    return jerryxx_timer_wheel_now;
+  }
+
+  uint64_t next = UINT64_MAX;
+
+  for (uint32_t level = 0; level < JERRYXX_TIMER_WHEEL_LEVELS; level++)
+  {
+    uint64_t bitmap = jerryxx_timer_wheel_bitmap[level];
+
+    if (bitmap == 0)
+    {
+      continue;
+    }
+
+    uint32_t shift = JERRYXX_TIMER_WHEEL_BITS * level;
+    uint64_t block = jerryxx_timer_wheel_now >> shift;
+    uint32_t start = (uint32_t)(block + 1) & JERRYXX_TIMER_WHEEL_MASK;
+    uint64_t rotated = start ? ((bitmap >> start) | (bitmap << (JERRYXX_TIMER_WHEEL_SLOTS - start))) : bitmap;
+    uint64_t tick = (block + __builtin_ctzll(rotated) + 1) << shift;
+
+    if (tick < next)
+    {
+      next = tick;
+    }
+  }
+
+  return next;
+} /* jerryxx_timer_wheel_next_tick */
+
+/**
+ * Take a timer from the pool and arm it.
+ *
+ * @return pointer to the timer - if the operation was successful,
+ *         NULL - if the pool is exhausted.
+ */
+static jerryxx_timer_t *
+jerryxx_timer_create(jerry_value_t callback_fn, /**< function to call */
+                     uint32_t delay_time,       /**< delay in milliseconds */
+                     bool repeat,               /**< true for setInterval */
+                     uint8_t policy,            /**< jerryxx_interval_policy_t of an interval */
+                     uint32_t slack)            /**< tolerated delay in milliseconds */
+{
+  jerryxx_timer_wheel_init();
+
+  if (jerryxx_timer_list_is_empty(&jerryxx_timer_free))
+  {
+    return NULL;
+  }
+
+  jerryxx_timer_t *timer_p = (jerryxx_timer_t *)jerryxx_timer_free.next_p;
+  jerryxx_timer_list_remove(&timer_p->link);
+
+  /* As in browsers an interval cannot run faster than once per millisecond */
+  if (repeat && delay_time == 0)
+  {
+    delay_time = 1;
+  }
+
+  /* The slack of an interval must not reach the next period */
+  if (repeat && slack >= delay_time)
+  {
+    slack = delay_time - 1;
+  }
+
+  /* Bring the wheel to the current time, so the delay is relative to now */
+  uint64_t now = jerryxx_clock_us();
+  jerryxx_timer_wheel_advance(now / 1000);
+
+  timer_p->deadline = now + (uint64_t)delay_time * 1000;
+  timer_p->interval = repeat ? delay_time : 0;
+  timer_p->callback_fn = jerry_value_copy(callback_fn);
+  timer_p->kind = JERRYXX_TIMER_CALLBACK;
+  timer_p->policy = policy;
+  timer_p->cancelled = false;
+  timer_p->slack = slack;
+  timer_p->ticks = 1;
+  timer_p->fired = 0;
+  timer_p->overruns = 0;
+  timer_p->missed = 0;
+  timer_p->max_lateness = 0;
+  timer_p->coalesced = 0;
+  jerryxx_timer_armed_count++;
+
+  jerryxx_timer_arm(timer_p);
+
+  return timer_p;
+} /* jerryxx_timer_create */
+
+/**
+ * Take a record from the pool and queue it in the idle lane.
+ *
+ * @return pointer to the record - if the operation was successful,
+ *         NULL - if the pool is exhausted.
+ */
+static jerryxx_timer_t *
+jerryxx_idle_create(jerry_value_t callback_fn) /**< function to call */
+{
+  jerryxx_timer_t *timer_p = jerryxx_timer_create(callback_fn, 0, false, JERRYXX_INTERVAL_FIXED_DELAY, 0);
+
+  if (timer_p != NULL)
+  {
+    /* Take it out of the timing wheel or the due list, wherever jerryxx_timer_arm put it */
+    jerryxx_timer_disarm(timer_p);
+    timer_p->kind = JERRYXX_TIMER_IDLE;
+    jerryxx_timer_list_append(&jerryxx_idle_queue, &timer_p->link);
+  }
+
+  return timer_p;
+} /* jerryxx_idle_create */
+
+/**
+ * Give a timer back to the pool, invalidating its identifier.
+ */
+static void
+jerryxx_timer_release(jerryxx_timer_t *timer_p) /**< timer to release */
+{
+  jerry_value_free(timer_p->callback_fn);
+
+  if (++timer_p->generation == 0)
+  {
+    timer_p->generation = 1;
+  }
+
+  timer_p->state = JERRYXX_TIMER_FREE;
+  jerryxx_timer_armed_count--;
+  jerryxx_timer_list_append(&jerryxx_timer_free, &timer_p->link);
+} /* jerryxx_timer_release */
+
+/**
+ * Compute the next deadline of an interval after its callback returned and arm it.
+ *
+ * Fixed-delay intervals wait a full period from now. Fixed-rate intervals
+ * advance on a grid of absolute deadlines; when the next one is already past
+ * the missed periods are skipped, called back to back, or folded into one call.
+ */
+static void
+jerryxx_timer_rearm(jerryxx_timer_t *timer_p) /**< interval to re-arm */
+{
+  uint64_t now = jerryxx_clock_us();
+  uint64_t period = (uint64_t)timer_p->interval * 1000;
+
+  timer_p->ticks = 1;
+
+  if (timer_p->policy == JERRYXX_INTERVAL_FIXED_DELAY)
+  {
+    timer_p->deadline = now + period;
+  }
+  else
+  {
+    timer_p->deadline += period;
+
+    if (timer_p->deadline <= now)
+    {
+      uint32_t missed = (uint32_t)((now - timer_p->deadline) / period) + 1;
+      timer_p->overruns++;
+
+      if (timer_p->policy != JERRYXX_INTERVAL_CATCH_UP)
+      {
+        timer_p->deadline += (uint64_t)missed * period;
+        timer_p->missed += missed;
+
+        if (timer_p->policy == JERRYXX_INTERVAL_COALESCE)
+        {
+          timer_p->ticks += missed;
+        }
+      }
+    }
+  }
+
+  jerryxx_timer_arm(timer_p);
+} /* jerryxx_timer_rearm */
+
+/**
+ * Check whether an expired timer belongs to the batch of the running pass.
+ *
+ * @return true - if the timer waits in jerryxx_timer_batch,
+ *         false - otherwise.
+ */
+static bool
+jerryxx_timer_in_batch(const jerryxx_timer_t *timer_p) /**< expired timer */
+{
+  for (const jerryxx_timer_link_t *link_p = jerryxx_timer_batch.next_p; link_p != &jerryxx_timer_batch; link_p = link_p->next_p)
+  {
+    if (link_p == &timer_p->link)
+    {
+      return true;
+    }
+  }
+
+  return false;
+} /* jerryxx_timer_in_batch */
+
+/**
+ * Cancel a pending timer, or the running one if it is clearing itself.
+ */
+static void
+jerryxx_timer_cancel(uint32_t id) /**< identifier of the timer */
+{
+  jerryxx_timer_t *timer_p = jerryxx_timer_from_id(id);
+
+  if (timer_p == NULL)
+  {
+    return;
+  }
+
+  if (timer_p->state == JERRYXX_TIMER_RUNNING)
+  {
+    timer_p->cancelled = true;
+    return;
+  }
+
+  /* Cleared by an earlier callback of the same pass: it leaves the backlog with the batch */
+  if (timer_p->state == JERRYXX_TIMER_DUE && jerryxx_timer_in_batch(timer_p))
+  {
+    jerryxx_loop_backlog--;
+  }
+
+  jerryxx_timer_disarm(timer_p);
+  jerryxx_timer_release(timer_p);
+} /* jerryxx_timer_cancel */
+
+static uint64_t jerryxx_budget_time = 0;
+static uint8_t jerryxx_budget_mode = JERRYXX_BUDGET_THROW;
+static bool jerryxx_budget_active = false;
+static bool jerryxx_budget_exceeded = false;
+static uint64_t jerryxx_budget_start = 0;
+static jerry_value_t jerryxx_budget_exception;
+static uint32_t jerryxx_budget_overruns = 0;
+
+#if JERRY_VM_HALT
+/**
+ * VM halt callback which stops the callbacks running past their time budget.
+ *
+ * @return undefined - to continue the execution,
+ *         the exception to throw - otherwise.
+ */
+static jerry_value_t
+jerryxx_budget_halt_cb(void *user_p) /**< unused */
+{
+  JERRYX_UNUSED(user_p);
+
+  if (!jerryxx_budget_active)
+  {
+    return jerry_undefined();
+  }
+
+  if (!jerryxx_budget_exceeded)
+  {
+    if (jerryxx_clock_us() - jerryxx_budget_start <= jerryxx_budget_time)
+    {
+      return jerry_undefined();
+    }
+
+    jerryxx_budget_exceeded = true;
+    jerryxx_budget_overruns++;
+
+    if (jerryxx_budget_mode == JERRYXX_BUDGET_REPORT)
+    {
+      JERRYX_WARNING_MSG("Callback exceeded its time budget of %u ms\n", (unsigned)(jerryxx_budget_time / 1000));
+      return jerry_undefined();
+    }
+
+    jerry_value_t error_val = jerry_error_sz(JERRY_ERROR_RANGE, "Callback exceeded its time budget");
+
+    if (jerryxx_budget_mode == JERRYXX_BUDGET_ABORT)
+    {
+      jerryxx_budget_exception = jerry_throw_abort(error_val, true);
+    }
+    else
+    {
+      jerryxx_budget_exception = jerry_throw_value(error_val, true);
+    }
+  }
+
+  if (jerryxx_budget_mode == JERRYXX_BUDGET_REPORT)
+  {
+    return jerry_undefined();
+  }
+
+  /* The engine requires the same value to be returned until the callback stops */
+  return jerry_value_copy(jerryxx_budget_exception);
+} /* jerryxx_budget_halt_cb */
+#endif /* JERRY_VM_HALT */
+
+/**
+ * Set the CPU time budget of every callback called by the event loop.
+ * Requires JERRY_VM_HALT, must be called after jerry_init.
+ *
+ * @return true - if the operation was successful,
+ *         false - if the engine was built without JERRY_VM_HALT.
+ */
+bool jerryxx_set_callback_budget(uint32_t budget_ms,          /**< budget in milliseconds, 0 to disable it */
+                                 jerryxx_budget_mode_t mode,  /**< action on overrun */
+                                 uint32_t interval)           /**< VM halt checks between two reads of the clock */
+{
+#if JERRY_VM_HALT
+  jerryxx_budget_time = (uint64_t)budget_ms * 1000;
+  jerryxx_budget_mode = (uint8_t)mode;
+
+  /* Without a budget no callback is installed, so the VM only pays the counter check */
+  if (budget_ms == 0)
+  {
+    jerry_halt_handler(0, NULL, NULL);
+  }
+  else
+  {
+    jerry_halt_handler(interval, jerryxx_budget_halt_cb, NULL);
+  }
+
+  return true;
+#else /* !JERRY_VM_HALT */
+  JERRYX_UNUSED(budget_ms);
+  JERRYX_UNUSED(mode);
+  JERRYX_UNUSED(interval);
+  return false;
+#endif /* JERRY_VM_HALT */
+} /* jerryxx_set_callback_budget */
+
+/**
+ * Start measuring the time budget of a callback.
+ */
+static inline void
+jerryxx_budget_begin(void)
+{
+  jerryxx_budget_start = jerryxx_clock_us();
+  jerryxx_budget_exceeded = false;
+  jerryxx_budget_active = jerryxx_budget_time != 0;
+} /* jerryxx_budget_begin */
+
+/**
+ * Stop measuring the time budget of a callback.
+ */
+static inline void
+jerryxx_budget_end(void)
+{
+  if (jerryxx_budget_exceeded && jerryxx_budget_mode != JERRYXX_BUDGET_REPORT)
+  {
+    jerry_value_free(jerryxx_budget_exception);
+  }
+
+  jerryxx_budget_active = false;
+  jerryxx_budget_exceeded = false;
+} /* jerryxx_budget_end */
+
+/**
+ * Run all the enqueued Promise jobs, reporting the exceptions they throw.
+ * Must be called from the thread which owns the engine.
+ */
+void jerryxx_run_jobs(void)
+{
+  jerryxx_budget_begin();
+  jerry_value_t result_val = jerry_run_jobs();
+  jerryxx_budget_end();
+
+  /* The queue stops at the first exception: report it and continue with the next job */
+  while (jerry_value_is_exception(result_val))
+  {
+    jerryx_print_unhandled_exception(result_val);
+
+    jerryxx_budget_begin();
+    result_val = jerry_run_jobs();
+    jerryxx_budget_end();
+  }
+
+  jerry_value_free(result_val);
+} /* jerryxx_run_jobs */
+
+/**
+ * Account a callback, jobs included, which started at the given time.
+ */
+static inline void
+jerryxx_loop_stats_callback(uint64_t start) /**< start of the callback in microseconds */
+{
+  uint64_t duration = jerryxx_clock_us() - start;
+
+  jerryxx_loop_stats.callbacks++;
+  jerryxx_loop_stats.callback_time += duration;
+
+  if (duration > jerryxx_loop_stats.max_callback_time)
+  {
+    jerryxx_loop_stats.max_callback_time = (uint32_t)(duration < UINT32_MAX ? duration : UINT32_MAX);
+  }
+} /* jerryxx_loop_stats_callback */
+
+/**
+ * Account the lateness of a timer in its bucket of the histogram.
+ */
+static inline void
+jerryxx_loop_stats_lateness(uint64_t lateness) /**< lateness in microseconds */
+{
+  uint32_t bucket = 0;
+
+  while (bucket < JERRYXX_LATENESS_BUCKETS - 1 && lateness > jerryxx_lateness_bounds[bucket])
+  {
+    bucket++;
+  }
+
+  jerryxx_loop_stats.lateness[bucket]++;
+} /* jerryxx_loop_stats_lateness */
+
+/**
+ * Call a JavaScript callback from the event loop, report its exception
+ * and run the Promise jobs it enqueued.
+ */
+static void
+jerryxx_call_callback(jerry_value_t callback_fn,   /**< function to call */
+                      const jerry_value_t args_p[], /**< function arguments */
+                      jerry_length_t args_cnt)      /**< number of function arguments */
+{
+  uint64_t start = jerryxx_clock_us();
+  jerry_value_t global_obj_val = jerry_current_realm();
+
+  jerryxx_budget_begin();
+  jerry_value_t result_val = jerry_call(callback_fn, global_obj_val, args_p, args_cnt);
+  jerryxx_budget_end();
+
+  jerry_value_free(global_obj_val);
+
+  if (jerry_value_is_exception(result_val))
+  {
+    jerryx_print_unhandled_exception(result_val);
+  }
+  else
+  {
+    jerry_value_free(result_val);
+  }
+
+  jerryxx_run_jobs();
+  jerryxx_loop_stats_callback(start);
+} /* jerryxx_call_callback */
+
+/**
+ * Resolve or reject a Promise from the event loop and run the jobs of its reactions.
+ */
+static void
+jerryxx_settle_promise(jerry_value_t promise,  /**< Promise to settle */
+                       jerry_value_t argument, /**< resolution value or rejection reason */
+                       bool resolve)           /**< true to resolve, false to reject */
+{
+  uint64_t start = jerryxx_clock_us();
+  jerry_value_t result_val = resolve ? jerry_promise_resolve(promise, argument) : jerry_promise_reject(promise, argument);
+
+  if (jerry_value_is_exception(result_val))
+  {
+    jerryx_print_unhandled_exception(result_val);
+  }
+  else
+  {
+    jerry_value_free(result_val);
+  }
+
+  jerryxx_run_jobs();
+  jerryxx_loop_stats_callback(start);
+} /* jerryxx_settle_promise */
+
+/**
+ * Sampling action of a native ticker.
+ */
+typedef enum
+{
+  JERRYXX_TICKER_ANALOG,  /**< ADC conversion, averaged over the decimation */
+  JERRYXX_TICKER_DIGITAL, /**< pin level, summed over the decimation */
+  JERRYXX_TICKER_COUNTER, /**< rising edges since the previous tick, summed over the decimation */
+} jerryxx_ticker_action_t;
+
+/**
+ * Native ticker armed by setTicker. The interrupt fills one half of the
+ * buffer while the engine thread delivers the other one.
+ */
+typedef struct
+{
+  mbed::Ticker ticker;           /**< hardware timer */
+  jerry_value_t callback_fn;     /**< function receiving the batches */
+  uint16_t generation;           /**< incremented every time the ticker is released */
+  uint8_t action;                /**< jerryxx_ticker_action_t */
+  bool active;                   /**< ticker running */
+  jerryxx_gpio_t gpio;           /**< pin of the digital action */
+  analogin_t adc;                /**< pin of the analog action */
+  mbed::InterruptIn *edge_p;     /**< pin of the counter action */
+  uint32_t pin;                  /**< Arduino pin */
+  volatile uint32_t edges;       /**< rising edges counted by the pin interrupt */
+  uint32_t last_edges;           /**< edges at the previous tick */
+  uint32_t batch;                /**< samples per callback */
+  uint32_t decimate;             /**< ticks per sample */
+  uint32_t sum;                  /**< accumulator of the current sample */
+  uint32_t sum_ticks;            /**< ticks in the accumulator */
+  uint32_t count;                /**< samples in the half being filled */
+  volatile uint8_t fill;         /**< half being filled by the interrupt */
+  volatile int8_t ready;         /**< half waiting for the engine thread, -1 if none */
+  volatile uint32_t ticks;       /**< number of ticks */
+  volatile uint32_t batches;     /**< number of batches completed */
+  volatile uint32_t overruns;    /**< batches dropped because the previous one was not delivered yet */
+  uint16_t buffer[2][JERRYXX_TICKER_BATCH_MAX]; /**< samples */
+} jerryxx_ticker_t;
+
+static jerryxx_ticker_t jerryxx_tickers[JERRYXX_TICKER_COUNT];
+static uint32_t jerryxx_ticker_active_count = 0;
+
+/**
+ * Interrupt of the pin of a counter ticker.
+ */
+static void
+jerryxx_ticker_edge_isr(jerryxx_ticker_t *ticker_p) /**< ticker */
+{
+  ticker_p->edges++;
+} /* jerryxx_ticker_edge_isr */
+
+/**
+ * Interrupt of the hardware timer of a ticker: take a sample, and hand the
+ * batch over to the engine thread once complete. No JavaScript runs here.
+ */
+static void
+jerryxx_ticker_isr(jerryxx_ticker_t *ticker_p) /**< ticker */
+{
+  uint32_t value;
+
+  switch (ticker_p->action)
+  {
+    case JERRYXX_TICKER_ANALOG:
+      value = analogin_read_u16(&ticker_p->adc);
+      break;
+    case JERRYXX_TICKER_DIGITAL:
+      value = jerryxx_gpio_read(&ticker_p->gpio);
+      break;
+    default:
+    {
+      uint32_t edges = ticker_p->edges;
+      value = edges - ticker_p->last_edges;
+      ticker_p->last_edges = edges;
+      break;
+    }
+  }
+
+  ticker_p->ticks++;
+  ticker_p->sum += value;
+
+  if (++ticker_p->sum_ticks < ticker_p->decimate)
+  {
+    return;
+  }
+
+  uint32_t sample = ticker_p->action == JERRYXX_TICKER_ANALOG ? ticker_p->sum / ticker_p->decimate : ticker_p->sum;
+  ticker_p->buffer[ticker_p->fill][ticker_p->count] = (uint16_t)(sample < UINT16_MAX ? sample : UINT16_MAX);
+  ticker_p->sum = 0;
+  ticker_p->sum_ticks = 0;
+
+  if (++ticker_p->count < ticker_p->batch)
+  {
+    return;
+  }
+
+  ticker_p->count = 0;
+
+  if (ticker_p->ready >= 0)
+  {
+    /* The engine thread is late: refill the same half */
+    ticker_p->overruns++;
+    return;
+  }
+
+  ticker_p->batches++;
+  ticker_p->ready = (int8_t)ticker_p->fill;
+  ticker_p->fill ^= 1;
+  jerryxx_scheduler_wake();
+} /* jerryxx_ticker_isr */
+
+/**
+ * Build the identifier of a ticker: generation in the high half, index in the low half.
+ *
+ * @return identifier of the ticker
+ */
+static inline uint32_t
+jerryxx_ticker_id(const jerryxx_ticker_t *ticker_p) /**< ticker */
+{
+  return ((uint32_t)ticker_p->generation << 16) | (uint32_t)(ticker_p - jerryxx_tickers);
+} /* jerryxx_ticker_id */
+
+/**
+ * Find the running ticker referenced by an identifier.
+ *
+ * @return pointer to the ticker - if the identifier is still valid,
+ *         NULL - otherwise.
+ */
+static jerryxx_ticker_t *
+jerryxx_ticker_from_id(uint32_t id) /**< identifier of the ticker */
+{
+  uint32_t idx = id & 0xFFFF;
+
+  if (idx >= JERRYXX_TICKER_COUNT)
+  {
+    return NULL;
+  }
+
+  jerryxx_ticker_t *ticker_p = &jerryxx_tickers[idx];
+
+  if (!ticker_p->active || ticker_p->generation != (id >> 16))
+  {
+    return NULL;
+  }
+
+  return ticker_p;
+} /* jerryxx_ticker_from_id */
+
+/**
+ * Start a native ticker on a free slot.
+ *
+ * @return pointer to the ticker - if the operation was successful,
+ *         NULL - if all the tickers are running.
+ */
+static jerryxx_ticker_t *
+jerryxx_ticker_create(jerry_value_t callback_fn, /**< function receiving the batches */
+                      uint32_t period_us,        /**< period of the ticks in microseconds */
+                      uint8_t action,            /**< jerryxx_ticker_action_t */
+                      uint32_t pin,              /**< sampled Arduino pin, checked by the caller */
+                      uint32_t batch,            /**< samples per callback */
+                      uint32_t decimate)         /**< ticks per sample */
+{
+  jerryxx_ticker_t *ticker_p = NULL;
+
+  for (uint32_t idx = 0; idx < JERRYXX_TICKER_COUNT; idx++)
+  {
+    if (!jerryxx_tickers[idx].active)
+    {
+      ticker_p = &jerryxx_tickers[idx];
+      break;
+    }
+  }
+
+  if (ticker_p == NULL)
+  {
+    return NULL;
+  }
+
+  /* The batches are delivered by the event loop */
+  jerryxx_timer_wheel_init();
+
+  ticker_p->callback_fn = jerry_value_copy(callback_fn);
+  ticker_p->action = action;
+  ticker_p->pin = pin;
+  ticker_p->edge_p = NULL;
+  ticker_p->edges = 0;
+  ticker_p->last_edges = 0;
+  ticker_p->batch = batch;
+  ticker_p->decimate = decimate;
+  ticker_p->sum = 0;
+  ticker_p->sum_ticks = 0;
+  ticker_p->count = 0;
+  ticker_p->fill = 0;
+  ticker_p->ready = -1;
+  ticker_p->ticks = 0;
+  ticker_p->batches = 0;
+  ticker_p->overruns = 0;
+
+  if (ticker_p->generation == 0)
+  {
+    ticker_p->generation = 1;
+  }
+
+  switch (action)
+  {
+    case JERRYXX_TICKER_ANALOG:
+      analogin_init(&ticker_p->adc, digitalPinToPinName((pin_size_t)pin));
+      break;
+    case JERRYXX_TICKER_DIGITAL:
+      jerryxx_gpio_from_pin(pin, &ticker_p->gpio);
+      break;
+    default:
+      jerryxx_exti_claim(pin);
+      ticker_p->edge_p = new mbed::InterruptIn(digitalPinToPinName((pin_size_t)pin));
+      ticker_p->edge_p->rise(mbed::callback(jerryxx_ticker_edge_isr, ticker_p));
+      break;
+  }
+
+  ticker_p->active = true;
+  jerryxx_ticker_active_count++;
+  ticker_p->ticker.attach(mbed::callback(jerryxx_ticker_isr, ticker_p), std::chrono::microseconds(period_us));
+
+  return ticker_p;
+} /* jerryxx_ticker_create */
+
+/**
+ * Stop a ticker and give its slot back, invalidating its identifier.
+ */
+static void
+jerryxx_ticker_release(jerryxx_ticker_t *ticker_p) /**< ticker to release */
+{
+  ticker_p->ticker.detach();
+
+  if (ticker_p->edge_p != NULL)
+  {
+    delete ticker_p->edge_p;
+    ticker_p->edge_p = NULL;
+    jerryxx_exti_release(ticker_p->pin);
+  }
+
+  jerry_value_free(ticker_p->callback_fn);
+
+  if (++ticker_p->generation == 0)
+  {
+    ticker_p->generation = 1;
+  }
+
+  ticker_p->active = false;
+  jerryxx_ticker_active_count--;
+} /* jerryxx_ticker_release */
+
+/**
+ * Find a ticker with a completed batch.
+ *
+ * @return pointer to the ticker - if a batch is waiting,
+ *         NULL - otherwise.
+ */
+static jerryxx_ticker_t *
+jerryxx_ticker_ready(void)
+{
+  for (uint32_t idx = 0; idx < JERRYXX_TICKER_COUNT; idx++)
+  {
+    if (jerryxx_tickers[idx].active && jerryxx_tickers[idx].ready >= 0)
+    {
+      return &jerryxx_tickers[idx];
+    }
+  }
+
+  return NULL;
+} /* jerryxx_ticker_ready */
+
+/**
+ * Deliver the completed batch of a ticker to its callback.
+ */
+static void
+jerryxx_ticker_deliver(jerryxx_ticker_t *ticker_p) /**< ticker with a completed batch */
+{
+  jerry_value_t samples = jerry_typedarray(JERRY_TYPEDARRAY_UINT16, ticker_p->batch);
+
+  if (jerry_value_is_exception(samples))
+  {
+    /* Out of memory: keep the batch for the next pass, the interrupt counts the overruns */
+    jerry_value_free(samples);
+    return;
+  }
+
+  jerry_length_t count = 0;
+  uint16_t *target_p = (uint16_t *)jerryxx_typedarray_data(samples, JERRY_TYPEDARRAY_UINT16, &count);
+  memcpy(target_p, ticker_p->buffer[ticker_p->ready], count * sizeof(uint16_t));
+
+  /* The interrupt can fill this half again */
+  ticker_p->ready = -1;
+
+  /* The callback may clear its own ticker */
+  jerry_value_t callback_fn = jerry_value_copy(ticker_p->callback_fn);
+  jerryxx_call_callback(callback_fn, &samples, 1);
+  jerry_value_free(callback_fn);
+  jerry_value_free(samples);
+} /* jerryxx_ticker_deliver */
+
+/**
+ * An edge seen by the interrupt of a pin, waiting for its JavaScript handler.
+ */
+typedef struct
+{
+  uint32_t timestamp; /**< value of us_ticker_read at the interrupt */
+  uint8_t pin;        /**< Arduino pin */
+  uint8_t edge;       /**< RISING or FALLING */
+} jerryxx_interrupt_record_t;
+
+/**
+ * Timestamps of the edges of a pin in batch mode. The interrupt fills one
+ * half of the buffer while the engine thread delivers the other one.
+ */
+typedef struct
+{
+  mbed::Timeout window;      /**< hands a partial batch over when its window ends */
+  uint32_t window_us;        /**< maximum age of the first edge of a batch, 0 for none */
+  uint32_t size;             /**< edges per batch */
+  uint32_t count;            /**< edges in the half being filled */
+  uint32_t length[2];        /**< edges in each half */
+  uint8_t edge[2];           /**< RISING or FALLING, direction of the first edge of each half */
+  volatile uint8_t fill;     /**< half being filled by the interrupt */
+  volatile int8_t ready;     /**< half waiting for the engine thread, -1 if none */
+  volatile uint32_t batches; /**< number of batches handed over */
+  uint32_t *buffer_p;        /**< timestamps of the two halves, size each */
+} jerryxx_interrupt_batch_t;
+
+/**
+ * Debounce and glitch filter of a pin. The edges it rejects are counted
+ * as glitches and never reach the queue. The interrupt of a filtered pin is
+ * attached as CHANGE, so the filter follows the level in both directions
+ * whatever the mode.
+ */
+typedef struct
+{
+  mbed::Timeout stable;  /**< checks the level once the pin has been quiet for the stable window */
+  uint32_t stable_us;    /**< time the pin must keep its level before the change is reported, 0 for none */
+  uint32_t min_pulse_us; /**< edges closer than this to the last reported one are rejected, 0 for none */
+  uint32_t reported;     /**< value of us_ticker_read at the last reported edge */
+  uint32_t last;         /**< value of us_ticker_read at the last edge waiting for the stable window */
+  uint32_t burst;        /**< edges waiting for the stable window */
+  uint8_t level;         /**< HIGH or LOW, last level seen by the filter */
+} jerryxx_interrupt_filter_t;
+
+/**
+ * Handler of attachInterrupt on a pin.
+ */
+typedef struct
+{
+  jerry_value_t callback_fn;            /**< JavaScript handler */
+  jerryxx_gpio_t gpio;                  /**< port and mask of the pin, read by CHANGE interrupts and filters */
+  uint8_t mode;                         /**< LOW, HIGH, CHANGE, RISING or FALLING */
+  jerryxx_interrupt_batch_t *batch_p;   /**< timestamps in batch mode, NULL to queue every edge */
+  jerryxx_interrupt_filter_t *filter_p; /**< debounce and glitch filter, NULL for none */
+  uint32_t queued;                      /**< edges queued */
+  uint32_t dispatched;                  /**< edges delivered to the handler */
+  uint32_t overflows;                   /**< edges dropped because the queue was full */
+  uint32_t glitches;                    /**< edges rejected by the filter */
+} jerryxx_interrupt_t;
+
+/**
+ * Options of attachInterrupt.
+ */
+typedef struct
+{
+  uint32_t batch;        /**< edges per batch, 0 to call the handler for every edge */
+  uint32_t window_us;    /**< maximum age of the first edge of a batch, 0 for none */
+  uint32_t stable_us;    /**< debounce window, 0 for none */
+  uint32_t min_pulse_us; /**< minimum time between two reported edges, 0 for none */
+} jerryxx_interrupt_options_t;
+
+#define JERRYXX_INTERRUPT_WORDS ((PINS_COUNT + 31) / 32)
+#define JERRYXX_INTERRUPT_QUEUE_MASK (JERRYXX_INTERRUPT_QUEUE_SIZE - 1)
+
+#if (JERRYXX_INTERRUPT_QUEUE_SIZE & JERRYXX_INTERRUPT_QUEUE_MASK) != 0
+#error "JERRYXX_INTERRUPT_QUEUE_SIZE must be a power of two"
+#endif /* (JERRYXX_INTERRUPT_QUEUE_SIZE & JERRYXX_INTERRUPT_QUEUE_MASK) != 0 */
+
+static jerryxx_interrupt_t jerryxx_interrupts[PINS_COUNT];
+static uint32_t jerryxx_interrupt_attached[JERRYXX_INTERRUPT_WORDS];
+static uint32_t jerryxx_interrupt_attached_count = 0;
+static volatile uint32_t jerryxx_interrupt_batch_ready[JERRYXX_INTERRUPT_WORDS];
+
+/**
+ * Queue of the edges, filled by the pin interrupts and drained by the event
+ * loop. The GPIO interrupts share the same priority, so they never preempt
+ * each other and there is a single producer: only it writes the head, only
+ * the engine thread writes the tail.
+ */
+static jerryxx_interrupt_record_t jerryxx_interrupt_queue[JERRYXX_INTERRUPT_QUEUE_SIZE];
+static volatile uint32_t jerryxx_interrupt_head = 0;
+static volatile uint32_t jerryxx_interrupt_tail = 0;
+static jerryxx_interrupt_stats_t jerryxx_interrupt_stats;
+
+/**
+ * Latency histogram: exact below 8 microseconds, then 8 buckets per power of
+ * two up to JERRYXX_LATENCY_LIMIT_US, which gives percentiles within 12.5%.
+ */
+#define JERRYXX_LATENCY_LIMIT_US (1UL << 24)
+#define JERRYXX_LATENCY_BUCKETS (8 * 22)
+
+typedef struct
+{
+  uint32_t count;                              /**< number of samples */
+  uint32_t min;                                /**< shortest sample in microseconds */
+  uint32_t max;                                /**< longest sample in microseconds */
+  uint64_t sum;                                /**< total of the samples in microseconds */
+  uint32_t histogram[JERRYXX_LATENCY_BUCKETS]; /**< samples per bucket */
+} jerryxx_latency_t;
+
+static jerryxx_latency_t jerryxx_interrupt_latency[JERRYXX_LATENCY_COUNT];
+
+/**
+ * Bucket of a latency.
+ *
+ * @return index of the bucket
+ */
+static uint32_t
+jerryxx_latency_bucket(uint32_t value) /**< latency in microseconds */
+{
+  if (value >= JERRYXX_LATENCY_LIMIT_US)
+  {
+    return JERRYXX_LATENCY_BUCKETS - 1;
+  }
+
+  if (value < 8)
+  {
+    return value;
+  }
+
+  uint32_t exponent = 31 - __builtin_clz(value);
+  return 8 * (exponent - 2) + ((value >> (exponent - 3)) & 7);
+} /* jerryxx_latency_bucket */
+
+/**
+ * Largest latency of a bucket.
+ *
+ * @return latency in microseconds
+ */
+static uint32_t
+jerryxx_latency_bucket_max(uint32_t bucket) /**< index of the bucket */
+{
+  if (bucket < 8)
+  {
+    return bucket;
+  }
+
+  uint32_t exponent = bucket / 8 + 2;
+  return ((8 + (bucket & 7) + 1) << (exponent - 3)) - 1;
+} /* jerryxx_latency_bucket_max */
+
+/**
+ * Add a sample to a latency histogram.
+ */
+static void
+jerryxx_latency_add(jerryxx_latency_t *latency_p, /**< histogram */
+                    uint32_t value)               /**< latency in microseconds */
+{
+  if (latency_p->count == 0 || value < latency_p->min)
+  {
+    latency_p->min = value;
+  }
+
+  if (value > latency_p->max)
+  {
+    latency_p->max = value;
+  }
+
+  latency_p->count++;
+  latency_p->sum += value;
+  latency_p->histogram[jerryxx_latency_bucket(value)]++;
+} /* jerryxx_latency_add */
+
+/**
+ * Direction of the edge which raised the interrupt of a pin.
+ *
+ * @return RISING or FALLING
+ */
+static inline uint8_t
+jerryxx_interrupt_edge(const jerryxx_interrupt_t *interrupt_p) /**< handler of the pin */
+{
+  switch (interrupt_p->mode)
+  {
+    case RISING:
+    case HIGH:
+      return RISING;
+    case FALLING:
+    case LOW:
+      return FALLING;
+    default:
+      return jerryxx_gpio_read(&interrupt_p->gpio) == HIGH ? RISING : FALLING;
+  }
+} /* jerryxx_interrupt_edge */
+
+/**
+ * Hand the half being filled over to the engine thread, from an interrupt.
+ *
+ * @return true - if the operation was successful,
+ *         false - if the previous batch was not delivered yet.
+ */
+static bool
+jerryxx_interrupt_batch_swap(jerryxx_interrupt_batch_t *batch_p, /**< batch of the pin */
+                             uint32_t pin)                       /**< Arduino pin */
+{
+  if (batch_p->ready >= 0)
+  {
+    return false;
+  }
+
+  batch_p->window.detach();
+  batch_p->length[batch_p->fill] = batch_p->count;
+  batch_p->count = 0;
+  batch_p->batches++;
+  batch_p->ready = (int8_t)batch_p->fill;
+  batch_p->fill ^= 1;
+
+  core_util_atomic_fetch_or_u32(&jerryxx_interrupt_batch_ready[pin / 32], 1UL << (pin % 32));
+  jerryxx_scheduler_wake();
+  return true;
+} /* jerryxx_interrupt_batch_swap */
+
+/**
+ * End of the window of a partial batch. Runs from the timer interrupt, the
+ * critical section keeps the pin interrupt out while the halves are swapped.
+ */
+static void
+jerryxx_interrupt_window_isr(void *pin_p) /**< Arduino pin */
+{
+  uint32_t pin = (uint32_t)(uintptr_t)pin_p;
+  jerryxx_interrupt_batch_t *batch_p = jerryxx_interrupts[pin].batch_p;
+
+  core_util_critical_section_enter();
+
+  if (batch_p->count > 0 && !jerryxx_interrupt_batch_swap(batch_p, pin))
+  {
+    /* The engine thread is late: try again after another window */
+    batch_p->window.attach(mbed::callback(jerryxx_interrupt_window_isr, pin_p), std::chrono::microseconds(batch_p->window_us));
+  }
+
+  core_util_critical_section_exit();
+} /* jerryxx_interrupt_window_isr */
+
+/**
+ * Record the timestamp of an edge of a pin in batch mode.
+ */
+static void
+jerryxx_interrupt_batch_push(jerryxx_interrupt_t *interrupt_p, /**< handler of the pin */
+                             uint32_t pin,                     /**< Arduino pin */
+                             uint32_t timestamp,               /**< value of us_ticker_read at the edge */
+                             uint8_t edge)                     /**< RISING or FALLING */
+{
+  jerryxx_interrupt_batch_t *batch_p = interrupt_p->batch_p;
+
+  if (batch_p->count == batch_p->size && !jerryxx_interrupt_batch_swap(batch_p, pin))
+  {
+    /* Both halves are full */
+    interrupt_p->overflows++;
+    return;
+  }
+
+  if (batch_p->count == 0)
+  {
+    batch_p->edge[batch_p->fill] = edge;
+
+    if (batch_p->window_us != 0)
+    {
+      batch_p->window.attach(mbed::callback(jerryxx_interrupt_window_isr, (void *)(uintptr_t)pin), std::chrono::microseconds(batch_p->window_us));
+    }
+  }
+
+  batch_p->buffer_p[batch_p->fill * batch_p->size + batch_p->count] = timestamp;
+  interrupt_p->queued++;
+
+  if (++batch_p->count == batch_p->size)
+  {
+    jerryxx_interrupt_batch_swap(batch_p, pin);
+  }
+} /* jerryxx_interrupt_batch_push */
+
+/**
+ * Hand an edge over to the engine thread, in the batch of the pin or in the queue.
+ */
+static void
+jerryxx_interrupt_push(jerryxx_interrupt_t *interrupt_p, /**< handler of the pin */
+                       uint32_t pin,                     /**< Arduino pin */
+                       uint32_t timestamp,               /**< value of us_ticker_read at the edge */
+                       uint8_t edge)                     /**< RISING or FALLING */
+{
+  if (interrupt_p->batch_p != NULL)
+  {
+    jerryxx_interrupt_batch_push(interrupt_p, pin, timestamp, edge);
+    return;
+  }
+
+  uint32_t head = jerryxx_interrupt_head;
+  uint32_t count = head - jerryxx_interrupt_tail;
+
+  if (count >= JERRYXX_INTERRUPT_QUEUE_SIZE)
+  {
+    interrupt_p->overflows++;
+    jerryxx_interrupt_stats.overflows++;
+    return;
+  }
+
+  jerryxx_interrupt_record_t *record_p = &jerryxx_interrupt_queue[head & JERRYXX_INTERRUPT_QUEUE_MASK];
+  record_p->timestamp = timestamp;
+  record_p->pin = (uint8_t)pin;
+  record_p->edge = edge;
+
+  /* The record must be visible before the head which publishes it */
+  __DMB();
+  jerryxx_interrupt_head = head + 1;
+
+  interrupt_p->queued++;
+  jerryxx_interrupt_stats.queued++;
+
+  if (count + 1 > jerryxx_interrupt_stats.max_pending)
+  {
+    jerryxx_interrupt_stats.max_pending = count + 1;
+  }
+
+  jerryxx_scheduler_wake();
+} /* jerryxx_interrupt_push */
+
+/**
+ * Follow a new level of a filtered pin and check the change against the mode.
+ * A change in the direction the mode ignores only updates the level.
+ *
+ * @return RISING or FALLING - if the change must be reported,
+ *         0 - otherwise.
+ */
+static uint8_t
+jerryxx_interrupt_filter_level(jerryxx_interrupt_t *interrupt_p, /**< handler of the pin */
+                               uint8_t level,                    /**< HIGH or LOW */
+                               bool *glitch_p)                   /**< [out] true - if the level did not change */
+{
+  jerryxx_interrupt_filter_t *filter_p = interrupt_p->filter_p;
+
+  *glitch_p = level == filter_p->level;
+
+  if (*glitch_p)
+  {
+    return 0;
+  }
+
+  filter_p->level = level;
+
+  switch (interrupt_p->mode)
+  {
+    case RISING:
+    case HIGH:
+      return level == HIGH ? RISING : 0;
+    case FALLING:
+    case LOW:
+      return level == LOW ? FALLING : 0;
+    default:
+      return level == HIGH ? RISING : FALLING;
+  }
+} /* jerryxx_interrupt_filter_level */
+
+/**
+ * End of the stable window of a filtered pin: report the change if the level
+ * differs from the last one. Runs from the timer interrupt, the critical
+ * section keeps the pin interrupts out while the edge is handed over.
+ */
+static void
+jerryxx_interrupt_stable_isr(void *pin_p) /**< Arduino pin */
+{
+  uint32_t pin = (uint32_t)(uintptr_t)pin_p;
+  jerryxx_interrupt_t *interrupt_p = &jerryxx_interrupts[pin];
+  jerryxx_interrupt_filter_t *filter_p = interrupt_p->filter_p;
+
+  core_util_critical_section_enter();
+
+  bool glitch;
+  uint32_t burst = filter_p->burst;
+  uint8_t edge = jerryxx_interrupt_filter_level(interrupt_p, jerryxx_gpio_read(&interrupt_p->gpio), &glitch);
+  filter_p->burst = 0;
+
+  if (!glitch)
+  {
+    /* The last edge of the burst changed the level */
+    burst--;
+  }
+
+  if (edge != 0)
+  {
+    filter_p->reported = filter_p->last;
+    jerryxx_interrupt_push(interrupt_p, pin, filter_p->last, edge);
+  }
+
+  interrupt_p->glitches += burst;
+  jerryxx_interrupt_stats.glitches += burst;
+
+  core_util_critical_section_exit();
+} /* jerryxx_interrupt_stable_isr */
+
+/**
+ * Filter an edge of a pin with a debounce or glitch filter.
+ */
+static void
+jerryxx_interrupt_filter(jerryxx_interrupt_t *interrupt_p, /**< handler of the pin */
+                         uint32_t pin,                     /**< Arduino pin */
+                         uint32_t timestamp)               /**< value of us_ticker_read at the interrupt */
+{
+  jerryxx_interrupt_filter_t *filter_p = interrupt_p->filter_p;
+
+  if (filter_p->stable_us != 0)
+  {
+    if (timestamp - filter_p->reported < filter_p->min_pulse_us)
+    {
+      interrupt_p->glitches++;
+      jerryxx_interrupt_stats.glitches++;
+      return;
+    }
+
+    /* Wait for the pin to be quiet, every bounce restarts the window */
+    filter_p->last = timestamp;
+    filter_p->burst++;
+    filter_p->stable.attach(mbed::callback(jerryxx_interrupt_stable_isr, (void *)(uintptr_t)pin), std::chrono::microseconds(filter_p->stable_us));
+    return;
+  }
+
+  /* The level is followed even when the edge is rejected, so the next change is seen */
+  bool glitch;
+  uint8_t edge = jerryxx_interrupt_filter_level(interrupt_p, jerryxx_gpio_read(&interrupt_p->gpio), &glitch);
+
+  if (edge == 0)
+  {
+    /* A change in the direction the mode ignores is not a glitch */
+    if (glitch)
+    {
+      interrupt_p->glitches++;
+      jerryxx_interrupt_stats.glitches++;
+    }
+    return;
+  }
+
+  if (timestamp - filter_p->reported < filter_p->min_pulse_us)
+  {
+    interrupt_p->glitches++;
+    jerryxx_interrupt_stats.glitches++;
+    return;
+  }
+
+  filter_p->reported = timestamp;
+  jerryxx_interrupt_push(interrupt_p, pin, timestamp, edge);
+} /* jerryxx_interrupt_filter */
+
+/**
+ * Interrupt of a pin with a JavaScript handler.
+ */
+static void
+jerryxx_interrupt_isr(void *pin_p) /**< Arduino pin */
+{
+  uint32_t timestamp = us_ticker_read();
+  uint32_t pin = (uint32_t)(uintptr_t)pin_p;
+  jerryxx_interrupt_t *interrupt_p = &jerryxx_interrupts[pin];
+
+  if (interrupt_p->filter_p != NULL)
+  {
+    jerryxx_interrupt_filter(interrupt_p, pin, timestamp);
+    return;
+  }
+
+  jerryxx_interrupt_push(interrupt_p, pin, timestamp, jerryxx_interrupt_edge(interrupt_p));
+} /* jerryxx_interrupt_isr */
+
+/**
+ * Remove the JavaScript handler of a pin. Its queued edges are dropped by
+ * jerryxx_interrupt_dispatch.
+ */
+static void
+jerryxx_interrupt_detach(uint32_t pin) /**< Arduino pin, checked by the caller */
+{
+  uint32_t mask = 1UL << (pin % 32);
+
+  if (!(jerryxx_interrupt_attached[pin / 32] & mask))
+  {
+    return;
+  }
+
+  detachInterrupt((pin_size_t)pin);
+
+  jerryxx_interrupt_t *interrupt_p = &jerryxx_interrupts[pin];
+
+  if (interrupt_p->batch_p != NULL)
+  {
+    interrupt_p->batch_p->window.detach();
+    core_util_atomic_fetch_and_u32(&jerryxx_interrupt_batch_ready[pin / 32], ~mask);
+    delete[] interrupt_p->batch_p->buffer_p;
+    delete interrupt_p->batch_p;
+    interrupt_p->batch_p = NULL;
+  }
+
+  if (interrupt_p->filter_p != NULL)
+  {
+    interrupt_p->filter_p->stable.detach();
+    delete interrupt_p->filter_p;
+    interrupt_p->filter_p = NULL;
+  }
+
+  jerry_value_free(interrupt_p->callback_fn);
+  jerryxx_exti_release(pin);
+  jerryxx_interrupt_attached[pin / 32] &= ~mask;
+  jerryxx_interrupt_attached_count--;
+} /* jerryxx_interrupt_detach */
+
+/**
+ * Set the JavaScript handler of a pin, replacing the previous one.
+ */
+static void
+jerryxx_interrupt_attach(uint32_t pin,                                 /**< Arduino pin, checked by the caller */
+                         jerry_value_t callback_fn,                    /**< handler */
+                         uint32_t mode,                                /**< LOW, HIGH, CHANGE, RISING or FALLING */
+                         const jerryxx_interrupt_options_t *options_p) /**< options, checked by the caller */
+{
+  jerryxx_interrupt_detach(pin);
+
+  /* The events are delivered by the event loop */
+  jerryxx_timer_wheel_init();
+
+  jerryxx_interrupt_t *interrupt_p = &jerryxx_interrupts[pin];
+  interrupt_p->callback_fn = jerry_value_copy(callback_fn);
+  interrupt_p->mode = (uint8_t)mode;
+  interrupt_p->queued = 0;
+  interrupt_p->dispatched = 0;
+  interrupt_p->overflows = 0;
+  interrupt_p->glitches = 0;
+  jerryxx_gpio_from_pin(pin, &interrupt_p->gpio);
+
+  if (options_p->batch != 0)
+  {
+    jerryxx_interrupt_batch_t *batch_p = new jerryxx_interrupt_batch_t;
+    batch_p->window_us = options_p->window_us;
+    batch_p->size = options_p->batch;
+    batch_p->count = 0;
+    batch_p->fill = 0;
+    batch_p->ready = -1;
+    batch_p->batches = 0;
+    batch_p->buffer_p = new uint32_t[2 * options_p->batch];
+    interrupt_p->batch_p = batch_p;
+  }
+
+  if (options_p->stable_us != 0 || options_p->min_pulse_us != 0)
+  {
+    jerryxx_interrupt_filter_t *filter_p = new jerryxx_interrupt_filter_t;
+    filter_p->stable_us = options_p->stable_us;
+    filter_p->min_pulse_us = options_p->min_pulse_us;
+    filter_p->reported = us_ticker_read() - options_p->min_pulse_us;
+    filter_p->burst = 0;
+    filter_p->level = (uint8_t)jerryxx_gpio_read(&interrupt_p->gpio);
+    interrupt_p->filter_p = filter_p;
+  }
+
+  jerryxx_exti_claim(pin);
+  jerryxx_interrupt_attached[pin / 32] |= 1UL << (pin % 32);
+  jerryxx_interrupt_attached_count++;
+
+  /* The filter follows the level both ways and checks the direction itself */
+  uint32_t hardware_mode = interrupt_p->filter_p != NULL ? CHANGE : mode;
+  attachInterruptParam((pin_size_t)pin, jerryxx_interrupt_isr, (PinStatus)hardware_mode, (void *)(uintptr_t)pin);
+} /* jerryxx_interrupt_attach */
+
+/**
+ * Number of edges waiting in the queue.
+ */
+static inline uint32_t
+jerryxx_interrupt_pending(void)
+{
+  return jerryxx_interrupt_head - jerryxx_interrupt_tail;
+} /* jerryxx_interrupt_pending */
+
+/**
+ * Call the JavaScript handler of the oldest queued edge with its pin, its
+ * edge and the value of micros() at the interrupt.
+ */
+static void
+jerryxx_interrupt_dispatch(void)
+{
+  uint32_t tail = jerryxx_interrupt_tail;
+
+  if (jerryxx_interrupt_head == tail)
+  {
+    return;
+  }
+
+  /* The head is read before the record it publishes */
+  __DMB();
+  jerryxx_interrupt_record_t record = jerryxx_interrupt_queue[tail & JERRYXX_INTERRUPT_QUEUE_MASK];
+  __DMB();
+  jerryxx_interrupt_tail = tail + 1;
+
+  uint32_t dequeued = us_ticker_read();
+
+  if (!(jerryxx_interrupt_attached[record.pin / 32] & (1UL << (record.pin % 32))))
+  {
+    return;
+  }
+
+  jerryxx_interrupt_t *interrupt_p = &jerryxx_interrupts[record.pin];
+  interrupt_p->dispatched++;
+  jerryxx_interrupt_stats.dispatched++;
+
+  /* Move the timestamp from the ticker to the time base of micros() */
+  uint32_t timestamp = record.timestamp + ((uint32_t)micros() - us_ticker_read());
+
+  jerry_value_t args[] = {
+    jerry_number(record.pin),
+    jerry_number(record.edge),
+    jerry_number(timestamp),
+  };
+
+  /* The handler may detach itself */
+  jerry_value_t callback_fn = jerry_value_copy(interrupt_p->callback_fn);
+  uint32_t start = us_ticker_read();
+  jerryxx_call_callback(callback_fn, args, sizeof(args) / sizeof(args[0]));
+  uint32_t end = us_ticker_read();
+  jerry_value_free(callback_fn);
+
+  for (uint32_t idx = 0; idx < sizeof(args) / sizeof(args[0]); idx++)
+  {
+    jerry_value_free(args[idx]);
+  }
+
+  jerryxx_latency_add(&jerryxx_interrupt_latency[JERRYXX_LATENCY_DEQUEUE], dequeued - record.timestamp);
+  jerryxx_latency_add(&jerryxx_interrupt_latency[JERRYXX_LATENCY_START], start - record.timestamp);
+  jerryxx_latency_add(&jerryxx_interrupt_latency[JERRYXX_LATENCY_CALLBACK], end - start);
+} /* jerryxx_interrupt_dispatch */
+
+/**
+ * Check whether a pin in batch mode has a batch waiting.
+ *
+ * @return true - if a batch is waiting,
+ *         false - otherwise.
+ */
+static bool
+jerryxx_interrupt_batch_is_ready(void)
+{
+  for (uint32_t word = 0; word < JERRYXX_INTERRUPT_WORDS; word++)
+  {
+    if (jerryxx_interrupt_batch_ready[word] != 0)
+    {
+      return true;
+    }
+  }
+
+  return false;
+} /* jerryxx_interrupt_batch_is_ready */
+
+/**
+ * Call the JavaScript handler of a pin in batch mode with a Uint32Array of
+ * the micros() times of the edges, the pin and the direction of the first edge.
+ */
+static void
+jerryxx_interrupt_batch_deliver(void)
+{
+  uint32_t pin = PINS_COUNT;
+
+  for (uint32_t word = 0; word < JERRYXX_INTERRUPT_WORDS; word++)
+  {
+    uint32_t ready = jerryxx_interrupt_batch_ready[word];
+
+    if (ready != 0)
+    {
+      uint32_t bit = __builtin_ctz(ready);
+      core_util_atomic_fetch_and_u32(&jerryxx_interrupt_batch_ready[word], ~(1UL << bit));
+      pin = word * 32 + bit;
+      break;
+    }
+  }
+
+  if (pin >= PINS_COUNT || jerryxx_interrupts[pin].batch_p == NULL || jerryxx_interrupts[pin].batch_p->ready < 0)
+  {
+    return;
+  }
+
+  jerryxx_interrupt_t *interrupt_p = &jerryxx_interrupts[pin];
+  jerryxx_interrupt_batch_t *batch_p = interrupt_p->batch_p;
+  uint32_t half = (uint32_t)batch_p->ready;
+  uint32_t length = batch_p->length[half];
+  const uint32_t *source_p = batch_p->buffer_p + half * batch_p->size;
+
+  jerry_value_t timestamps = jerry_typedarray(JERRY_TYPEDARRAY_UINT32, length);
+
+  if (jerry_value_is_exception(timestamps))
+  {
+    /* Out of memory: keep the batch for the next pass */
+    jerry_value_free(timestamps);
+    core_util_atomic_fetch_or_u32(&jerryxx_interrupt_batch_ready[pin / 32], 1UL << (pin % 32));
+
+    core_util_critical_section_enter();
+    interrupt_p->overflows++;
+    core_util_critical_section_exit();
+    return;
+  }
+
+  jerry_length_t count = 0;
+  uint32_t *target_p = (uint32_t *)jerryxx_typedarray_data(timestamps, JERRY_TYPEDARRAY_UINT32, &count);
+
+  /* Move the timestamps from the ticker to the time base of micros() */
+  uint32_t base = (uint32_t)micros() - us_ticker_read();
+
+  for (uint32_t idx = 0; idx < length; idx++)
+  {
+    target_p[idx] = source_p[idx] + base;
+  }
+
+  jerry_value_t args[] = {
+    timestamps,
+    jerry_number(pin),
+    jerry_number(batch_p->edge[half]),
+  };
+
+  /* The interrupt can fill this half again */
+  batch_p->ready = -1;
+  interrupt_p->dispatched += length;
+
+  /* The handler may detach itself */
+  jerry_value_t callback_fn = jerry_value_copy(interrupt_p->callback_fn);
+  jerryxx_call_callback(callback_fn, args, sizeof(args) / sizeof(args[0]));
+  jerry_value_free(callback_fn);
+
+  for (uint32_t idx = 0; idx < sizeof(args) / sizeof(args[0]); idx++)
+  {
+    jerry_value_free(args[idx]);
+  }
+} /* jerryxx_interrupt_batch_deliver */
+
+/**
+ * Progress of a pulseInAsync measurement.
+ */
+typedef enum
+{
+  JERRYXX_PULSE_WAIT_IDLE,  /**< pin at the level of the pulse, waiting for the previous pulse to end */
+  JERRYXX_PULSE_WAIT_START, /**< waiting for the pulse to start */
+  JERRYXX_PULSE_WAIT_END,   /**< waiting for the pulse to end */
+  JERRYXX_PULSE_DONE,       /**< width measured or timed out, waiting for the engine thread */
+} jerryxx_pulse_state_t;
+
+/**
+ * Measurement started by pulseInAsync, driven by the edge interrupts of its pin.
+ */
+typedef struct
+{
+  mbed::Timeout timeout;      /**< ends a measurement which found no complete pulse */
+  mbed::InterruptIn *edge_p;  /**< interrupts of the pin */
+  jerry_value_t promise;      /**< Promise resolved with the width */
+  uint32_t pin;               /**< Arduino pin */
+  uint32_t start;             /**< value of us_ticker_read at the start of the pulse */
+  uint32_t width;             /**< width of the pulse in microseconds, 0 on timeout */
+  uint8_t level;              /**< HIGH or LOW, level of the pulse */
+  volatile uint8_t state;     /**< jerryxx_pulse_state_t */
+  bool active;                /**< slot in use */
+} jerryxx_pulse_t;
+
+static jerryxx_pulse_t jerryxx_pulses[JERRYXX_PULSE_COUNT];
+static uint32_t jerryxx_pulse_active_count = 0;
+
+/**
+ * Edge of the pin of a measurement.
+ */
+static void
+jerryxx_pulse_edge(jerryxx_pulse_t *pulse_p, /**< measurement */
+                   uint8_t level)            /**< HIGH or LOW, new level of the pin */
+{
+  uint32_t timestamp = us_ticker_read();
+
+  switch (pulse_p->state)
+  {
+    case JERRYXX_PULSE_WAIT_IDLE:
+      if (level != pulse_p->level)
+      {
+        pulse_p->state = JERRYXX_PULSE_WAIT_START;
+      }
+      break;
+    case JERRYXX_PULSE_WAIT_START:
+      if (level == pulse_p->level)
+      {
+        pulse_p->start = timestamp;
+        pulse_p->state = JERRYXX_PULSE_WAIT_END;
+      }
+      break;
+    case JERRYXX_PULSE_WAIT_END:
+      if (level != pulse_p->level)
+      {
+        pulse_p->width = timestamp - pulse_p->start;
+        pulse_p->state = JERRYXX_PULSE_DONE;
+        pulse_p->timeout.detach();
+        jerryxx_scheduler_wake();
+      }
+      break;
+    default:
+      break;
+  }
+} /* jerryxx_pulse_edge */
+
+/**
+ * Rising edge of the pin of a measurement.
+ */
+static void
+jerryxx_pulse_rise_isr(jerryxx_pulse_t *pulse_p) /**< measurement */
+{
+  jerryxx_pulse_edge(pulse_p, HIGH);
+} /* jerryxx_pulse_rise_isr */
+
+/**
+ * Falling edge of the pin of a measurement.
+ */
+static void
+jerryxx_pulse_fall_isr(jerryxx_pulse_t *pulse_p) /**< measurement */
+{
+  jerryxx_pulse_edge(pulse_p, LOW);
+} /* jerryxx_pulse_fall_isr */
+
+/**
+ * Timeout of a measurement.
+ */
+static void
+jerryxx_pulse_timeout_isr(jerryxx_pulse_t *pulse_p) /**< measurement */
+{
+  if (pulse_p->state != JERRYXX_PULSE_DONE)
+  {
+    pulse_p->width = 0;
+    pulse_p->state = JERRYXX_PULSE_DONE;
+    jerryxx_scheduler_wake();
+  }
+} /* jerryxx_pulse_timeout_isr */
+
+/**
+ * Start measuring a pulse on a free slot.
+ *
+ * @return pointer to the measurement - if the operation was successful,
+ *         NULL - if all the slots are in use.
+ */
+static jerryxx_pulse_t *
+jerryxx_pulse_start(jerry_value_t promise, /**< Promise resolved with the width */
+                    uint32_t pin,          /**< Arduino pin with a free EXTI line, checked by the caller */
+                    uint8_t level,         /**< HIGH or LOW, level of the pulse */
+                    uint32_t timeout_us)   /**< maximum duration of the measurement in microseconds */
+{
+  jerryxx_pulse_t *pulse_p = NULL;
+
+  for (uint32_t idx = 0; idx < JERRYXX_PULSE_COUNT; idx++)
+  {
+    if (!jerryxx_pulses[idx].active)
+    {
+      pulse_p = &jerryxx_pulses[idx];
+      break;
+    }
+  }
+
+  if (pulse_p == NULL)
+  {
+    return NULL;
+  }
+
+  /* The result is delivered by the event loop */
+  jerryxx_timer_wheel_init();
+
+  jerryxx_gpio_t gpio;
+  jerryxx_gpio_from_pin(pin, &gpio);
+
+  pulse_p->promise = jerry_value_copy(promise);
+  pulse_p->pin = pin;
+  pulse_p->level = level;
+  pulse_p->width = 0;
+  pulse_p->active = true;
+  jerryxx_pulse_active_count++;
+
+  jerryxx_exti_claim(pin);
+  pulse_p->edge_p = new mbed::InterruptIn(digitalPinToPinName((pin_size_t)pin));
+
+  core_util_critical_section_enter();
+  pulse_p->state = jerryxx_gpio_read(&gpio) == level ? JERRYXX_PULSE_WAIT_IDLE : JERRYXX_PULSE_WAIT_START;
+  pulse_p->edge_p->rise(mbed::callback(jerryxx_pulse_rise_isr, pulse_p));
+  pulse_p->edge_p->fall(mbed::callback(jerryxx_pulse_fall_isr, pulse_p));
+  pulse_p->timeout.attach(mbed::callback(jerryxx_pulse_timeout_isr, pulse_p), std::chrono::microseconds(timeout_us));
+  core_util_critical_section_exit();
+
+  return pulse_p;
+} /* jerryxx_pulse_start */
+
+/**
+ * Stop a measurement and give its slot back, the caller owns its Promise.
+ */
+static void
+jerryxx_pulse_release(jerryxx_pulse_t *pulse_p) /**< measurement */
+{
+  pulse_p->timeout.detach();
+  delete pulse_p->edge_p;
+  pulse_p->edge_p = NULL;
+  jerryxx_exti_release(pulse_p->pin);
+  pulse_p->active = false;
+  jerryxx_pulse_active_count--;
+} /* jerryxx_pulse_release */
+
+/**
+ * Find a measurement which is done.
+ *
+ * @return pointer to the measurement - if one is waiting,
+ *         NULL - otherwise.
+ */
+static jerryxx_pulse_t *
+jerryxx_pulse_ready(void)
+{
+  for (uint32_t idx = 0; idx < JERRYXX_PULSE_COUNT; idx++)
+  {
+    if (jerryxx_pulses[idx].active && jerryxx_pulses[idx].state == JERRYXX_PULSE_DONE)
+    {
+      return &jerryxx_pulses[idx];
+    }
+  }
+
+  return NULL;
+} /* jerryxx_pulse_ready */
+
+/**
+ * Resolve the Promise of a measurement which is done with the width of the
+ * pulse in microseconds, 0 if it timed out.
+ */
+static void
+jerryxx_pulse_deliver(jerryxx_pulse_t *pulse_p) /**< measurement which is done */
+{
+  jerry_value_t promise = pulse_p->promise;
+  jerry_value_t width = jerry_number(pulse_p->width);
+
+  jerryxx_pulse_release(pulse_p);
+  jerryxx_settle_promise(promise, width, true);
+
+  jerry_value_free(width);
+  jerry_value_free(promise);
+} /* jerryxx_pulse_deliver */
+
+/**
+ * Frequency and duty cycle meter of a FrequencyCounter object. The pin
+ * interrupts time the edges, a ticker closes every gate and computes its
+ * results, read by the engine thread without further work.
+ */
+typedef struct
+{
+  mbed::Ticker gate;         /**< hardware-timed gate */
+  mbed::InterruptIn *edge_p; /**< interrupts of the pin */
+  jerryxx_gpio_t gpio;       /**< pin */
+  uint32_t pin;              /**< Arduino pin */
+  uint32_t gate_start;       /**< value of us_ticker_read at the start of the gate */
+  uint32_t rises;            /**< rising edges in the gate */
+  uint32_t first_rise;       /**< value of us_ticker_read at the first rising edge of the gate */
+  uint32_t last_rise;        /**< value of us_ticker_read at the last rising edge of the gate */
+  uint32_t high;             /**< time spent high during the gate in microseconds */
+  uint32_t high_start;       /**< value of us_ticker_read at the start of the high level */
+  bool is_high;              /**< level of the pin */
+  bool active;               /**< hardware still attached */
+  float frequency;           /**< frequency over the last gate in hertz */
+  float period;              /**< period over the last gate in microseconds */
+  float duty;                /**< fraction of the last gate spent high */
+  float min_frequency;       /**< lowest frequency of a gate since the last reset */
+  float max_frequency;       /**< highest frequency of a gate since the last reset */
+  uint32_t gates;            /**< gates completed since the last reset */
+  uint32_t edges;            /**< rising edges since the last reset */
+} jerryxx_frequency_t;
+
+/**
+ * Rising edge of the pin of a frequency counter.
+ */
+static void
+jerryxx_frequency_rise_isr(jerryxx_frequency_t *counter_p) /**< frequency counter */
+{
+  uint32_t timestamp = us_ticker_read();
+
+  if (counter_p->rises++ == 0)
+  {
+    counter_p->first_rise = timestamp;
+  }
+
+  counter_p->last_rise = timestamp;
+  counter_p->high_start = timestamp;
+  counter_p->is_high = true;
+  counter_p->edges++;
+} /* jerryxx_frequency_rise_isr */
+
+/**
+ * Falling edge of the pin of a frequency counter.
+ */
+static void
+jerryxx_frequency_fall_isr(jerryxx_frequency_t *counter_p) /**< frequency counter */
+{
+  uint32_t timestamp = us_ticker_read();
+
+  if (counter_p->is_high)
+  {
+    counter_p->high += timestamp - counter_p->high_start;
+    counter_p->is_high = false;
+  }
+} /* jerryxx_frequency_fall_isr */
+
+/**
+ * End of a gate: compute its results and start the next one. The frequency is
+ * reciprocal, measured between the first and the last rising edges of the
+ * gate, so it stays accurate for slow signals and short gates.
+ */
+static void
+jerryxx_frequency_gate_isr(jerryxx_frequency_t *counter_p) /**< frequency counter */
+{
+  core_util_critical_section_enter();
+
+  uint32_t now = us_ticker_read();
+  uint32_t elapsed = now - counter_p->gate_start;
+
+  if (counter_p->is_high)
+  {
+    counter_p->high += now - counter_p->high_start;
+    counter_p->high_start = now;
+  }
+
+  if (counter_p->rises >= 2 && counter_p->last_rise != counter_p->first_rise)
+  {
+    counter_p->period = (float)(counter_p->last_rise - counter_p->first_rise) / (float)(counter_p->rises - 1);
+    counter_p->frequency = 1000000.0f / counter_p->period;
+  }
+  else if (counter_p->rises == 1 && elapsed != 0)
+  {
+    counter_p->frequency = 1000000.0f / (float)elapsed;
+    counter_p->period = (float)elapsed;
+  }
+  else
+  {
+    counter_p->frequency = 0.0f;
+    counter_p->period = 0.0f;
+  }
+
+  counter_p->duty = elapsed != 0 ? (float)counter_p->high / (float)elapsed : (counter_p->is_high ? 1.0f : 0.0f);
+
+  if (counter_p->gates == 0 || counter_p->frequency < counter_p->min_frequency)
+  {
+    counter_p->min_frequency = counter_p->frequency;
+  }
+
+  if (counter_p->gates == 0 || counter_p->frequency > counter_p->max_frequency)
+  {
+    counter_p->max_frequency = counter_p->frequency;
+  }
+
+  counter_p->gates++;
+  counter_p->rises = 0;
+  counter_p->high = 0;
+  counter_p->gate_start = now;
+
+  core_util_critical_section_exit();
+} /* jerryxx_frequency_gate_isr */
+
+/**
+ * Clear the results and the statistics of a frequency counter.
+ */
+static void
+jerryxx_frequency_reset(jerryxx_frequency_t *counter_p) /**< frequency counter */
+{
+  core_util_critical_section_enter();
+  counter_p->frequency = 0.0f;
+  counter_p->period = 0.0f;
+  counter_p->duty = 0.0f;
+  counter_p->min_frequency = 0.0f;
+  counter_p->max_frequency = 0.0f;
+  counter_p->gates = 0;
+  counter_p->edges = 0;
+  core_util_critical_section_exit();
+} /* jerryxx_frequency_reset */
+
+/**
+ * Start measuring the signal of a pin, checked by the caller.
+ */
+static void
+jerryxx_frequency_init(jerryxx_frequency_t *counter_p, /**< frequency counter */
+                       uint32_t pin,                   /**< Arduino pin with a free EXTI line */
+                       uint32_t gate_us)               /**< duration of a gate in microseconds */
+{
+  jerryxx_gpio_from_pin(pin, &counter_p->gpio);
+  jerryxx_frequency_reset(counter_p);
+  counter_p->pin = pin;
+  jerryxx_exti_claim(pin);
+  counter_p->edge_p = new mbed::InterruptIn(digitalPinToPinName((pin_size_t)pin));
+
+  core_util_critical_section_enter();
+  counter_p->gate_start = us_ticker_read();
+  counter_p->high_start = counter_p->gate_start;
+  counter_p->is_high = jerryxx_gpio_read(&counter_p->gpio) == HIGH;
+  counter_p->rises = 0;
+  counter_p->high = 0;
+  counter_p->edge_p->rise(mbed::callback(jerryxx_frequency_rise_isr, counter_p));
+  counter_p->edge_p->fall(mbed::callback(jerryxx_frequency_fall_isr, counter_p));
+  counter_p->gate.attach(mbed::callback(jerryxx_frequency_gate_isr, counter_p), std::chrono::microseconds(gate_us));
+  core_util_critical_section_exit();
+
+  counter_p->active = true;
+} /* jerryxx_frequency_init */
+
+/**
+ * Stop measuring and give the pin back, keeping the last results.
+ */
+static void
+jerryxx_frequency_release(jerryxx_frequency_t *counter_p) /**< frequency counter */
+{
+  if (!counter_p->active)
+  {
+    return;
+  }
+
+  counter_p->gate.detach();
+  delete counter_p->edge_p;
+  counter_p->edge_p = NULL;
+  jerryxx_exti_release(counter_p->pin);
+  counter_p->active = false;
+} /* jerryxx_frequency_release */
+
+/**
+ * Free the frequency counter of a collected FrequencyCounter object.
+ */
+static void
+jerryxx_frequency_free(void *native_p,                     /**< frequency counter */
+                       jerry_object_native_info_t *info_p) /**< type information */
+{
+  JERRYX_UNUSED(info_p);
+  jerryxx_frequency_t *counter_p = (jerryxx_frequency_t *)native_p;
+
+  jerryxx_frequency_release(counter_p);
+  delete counter_p;
+} /* jerryxx_frequency_free */
+
+/**
+ * Type information of the FrequencyCounter objects.
+ */
+static const jerry_object_native_info_t jerryxx_frequency_info = {jerryxx_frequency_free, 0, 0};
+
+/**
+ * Player of a WaveformOut object: a ticker writes one sample of a Uint8Array or
+ * Uint16Array to its pins at every tick, read in place from the array.
+ */
+typedef struct
+{
+  mbed::Ticker ticker;       /**< hardware-timed sample clock */
+  jerryxx_pin_group_t group; /**< pins, bit n of a sample to the pin n */
+  uint32_t period_us;        /**< time between two samples */
+  jerry_value_t object;      /**< WaveformOut object, kept alive while playing */
+  jerry_value_t samples;     /**< array played, kept alive while playing */
+  jerry_value_t callback_fn; /**< function called at the end of each pass, or undefined */
+  const uint8_t *data_p;     /**< bytes of the samples */
+  uint32_t length;           /**< number of samples */
+  uint8_t width;             /**< bytes per sample, 1 or 2 */
+  bool loop;                 /**< circular, restart at the end of each pass */
+  bool allocated;            /**< slot owned by a WaveformOut object */
+  bool playing;              /**< playing or waiting for the delivery of its last pass */
+  volatile bool running;     /**< ticker attached */
+  volatile uint32_t index;   /**< next sample */
+  volatile uint32_t passes;  /**< passes completed */
+  uint32_t delivered;        /**< passes delivered to the callback */
+} jerryxx_waveform_t;
+
+static jerryxx_waveform_t jerryxx_waveforms[JERRYXX_WAVEFORM_COUNT];
+static uint32_t jerryxx_waveform_playing_count = 0;
+
+/**
+ * Sample tick of a waveform.
+ */
+static void
+jerryxx_waveform_isr(jerryxx_waveform_t *waveform_p) /**< waveform */
+{
+  uint32_t index = waveform_p->index;
+  uint32_t bits = waveform_p->width == 2 ? ((const uint16_t *)waveform_p->data_p)[index] : waveform_p->data_p[index];
+
+  jerryxx_pin_group_write(&waveform_p->group, bits);
+
+  if (++index < waveform_p->length)
+  {
+    waveform_p->index = index;
+    return;
+  }
+
+  waveform_p->index = 0;
+
+  if (!waveform_p->loop)
+  {
+    waveform_p->ticker.detach();
+    waveform_p->running = false;
+  }
+
+  waveform_p->passes++;
+  jerryxx_scheduler_wake();
+} /* jerryxx_waveform_isr */
+
+/**
+ * Stop a waveform and drop its samples and callback, the pins keep their last sample.
+ */
+static void
+jerryxx_waveform_stop(jerryxx_waveform_t *waveform_p) /**< waveform */
+{
+  waveform_p->ticker.detach();
+  waveform_p->running = false;
+
+  if (!waveform_p->playing)
+  {
+    return;
+  }
+
+  waveform_p->playing = false;
+  jerryxx_waveform_playing_count--;
+
+  jerry_value_free(waveform_p->samples);
+  jerry_value_free(waveform_p->callback_fn);
+  waveform_p->samples = jerry_undefined();
+  waveform_p->callback_fn = jerry_undefined();
+
+  /* Last, the object may be collected from now on */
+  jerry_value_t object = waveform_p->object;
+  waveform_p->object = jerry_undefined();
+  jerry_value_free(object);
+} /* jerryxx_waveform_stop */
+
+/**
+ * Start playing samples on a waveform, stopping the current ones. The object
+ * is kept alive until the waveform stops, so a playing waveform is never collected.
+ */
+static void
+jerryxx_waveform_play(jerryxx_waveform_t *waveform_p,  /**< waveform */
+                      const jerry_value_t object,      /**< WaveformOut object */
+                      const jerry_value_t samples,     /**< Uint8Array or Uint16Array, not empty */
+                      const uint8_t *data_p,           /**< bytes of the samples */
+                      uint32_t length,                 /**< number of samples */
+                      uint8_t width,                   /**< bytes per sample */
+                      const jerry_value_t callback_fn, /**< function called at the end of each pass, or undefined */
+                      bool loop)                       /**< circular */
+{
+  jerryxx_waveform_stop(waveform_p);
+
+  /* The passes are delivered by the event loop */
+  jerryxx_timer_wheel_init();
+
+  waveform_p->object = jerry_value_copy(object);
+  waveform_p->samples = jerry_value_copy(samples);
+  waveform_p->callback_fn = jerry_value_copy(callback_fn);
+  waveform_p->data_p = data_p;
+  waveform_p->length = length;
+  waveform_p->width = width;
+  waveform_p->loop = loop;
+  waveform_p->index = 0;
+  waveform_p->passes = 0;
+  waveform_p->delivered = 0;
+  waveform_p->playing = true;
+  waveform_p->running = true;
+  jerryxx_waveform_playing_count++;
+
+  waveform_p->ticker.attach(mbed::callback(jerryxx_waveform_isr, waveform_p), std::chrono::microseconds(waveform_p->period_us));
+} /* jerryxx_waveform_play */
+
+/**
+ * Find a waveform with a pass to deliver.
+ *
+ * @return pointer to the waveform - if one is waiting,
+ *         NULL - otherwise.
+ */
+static jerryxx_waveform_t *
+jerryxx_waveform_ready(void)
+{
+  for (uint32_t idx = 0; idx < JERRYXX_WAVEFORM_COUNT; idx++)
+  {
+    if (jerryxx_waveforms[idx].playing && jerryxx_waveforms[idx].passes != jerryxx_waveforms[idx].delivered)
+    {
+      return &jerryxx_waveforms[idx];
+    }
+  }
+
+  return NULL;
+} /* jerryxx_waveform_ready */
+
+/**
+ * Call the callback of a waveform with the number of passes completed. Passes
+ * completed while the engine was busy are reported by a single call.
+ */
+static void
+jerryxx_waveform_deliver(jerryxx_waveform_t *waveform_p) /**< waveform with a pass to deliver */
+{
+  waveform_p->delivered = waveform_p->passes;
+
+  jerry_value_t callback_fn = jerry_value_copy(waveform_p->callback_fn);
+  jerry_value_t args[] = {jerry_number(waveform_p->delivered)};
+
+  /* A one-shot waveform is done before its callback, which may play again */
+  if (!waveform_p->running)
+  {
+    jerryxx_waveform_stop(waveform_p);
+  }
+
+  if (jerry_value_is_function(callback_fn))
+  {
+    jerryxx_call_callback(callback_fn, args, sizeof(args) / sizeof(args[0]));
+  }
+
+  jerry_value_free(args[0]);
+  jerry_value_free(callback_fn);
+} /* jerryxx_waveform_deliver */
+
+/**
+ * Take a free waveform slot.
+ *
+ * @return pointer to the waveform - if a slot is free,
+ *         NULL - otherwise.
+ */
+static jerryxx_waveform_t *
+jerryxx_waveform_alloc(void)
+{
+  for (uint32_t idx = 0; idx < JERRYXX_WAVEFORM_COUNT; idx++)
+  {
+    if (!jerryxx_waveforms[idx].allocated)
+    {
+      jerryxx_waveforms[idx].allocated = true;
+      jerryxx_waveforms[idx].playing = false;
+      jerryxx_waveforms[idx].object = jerry_undefined();
+      jerryxx_waveforms[idx].samples = jerry_undefined();
+      jerryxx_waveforms[idx].callback_fn = jerry_undefined();
+      return &jerryxx_waveforms[idx];
+    }
+  }
+
+  return NULL;
+} /* jerryxx_waveform_alloc */
+
+/**
+ * Free the waveform of a collected WaveformOut object.
+ */
+static void
+jerryxx_waveform_free(void *native_p,                     /**< waveform */
+                      jerry_object_native_info_t *info_p) /**< type information */
+{
+  JERRYX_UNUSED(info_p);
+  jerryxx_waveform_t *waveform_p = (jerryxx_waveform_t *)native_p;
+
+  jerryxx_waveform_stop(waveform_p);
+  waveform_p->allocated = false;
+} /* jerryxx_waveform_free */
+
+/**
+ * Type information of the WaveformOut objects.
+ */
+static const jerry_object_native_info_t jerryxx_waveform_info = {jerryxx_waveform_free, 0, 0};
+
+/**
+ * Melody started by playSequence: a ticker toggles the pin at twice the frequency
+ * of the note, a timeout moves to the next note, both read in place from the arrays.
+ */
+typedef struct
+{
+  mbed::Ticker wave;             /**< square wave of the note */
+  mbed::Timeout note;            /**< end of the note */
+  jerryxx_gpio_t gpio;           /**< pin */
+  jerry_value_t promise;         /**< Promise resolved at the end */
+  jerry_value_t frequencies;     /**< Uint16Array of the frequencies in Hz, 0 for a rest */
+  jerry_value_t durations;       /**< Uint16Array of the durations in milliseconds */
+  const uint16_t *frequencies_p; /**< data of frequencies */
+  const uint16_t *durations_p;   /**< data of durations */
+  uint32_t length;               /**< number of notes */
+  uint32_t pin;                  /**< Arduino pin */
+  uint32_t index;                /**< next note */
+  bool high;                     /**< level of the pin */
+  bool completed;                /**< all the notes played, false if stopped by noTone */
+  volatile bool done;            /**< ended, waiting for the engine thread */
+  bool active;                   /**< slot in use */
+} jerryxx_sequence_t;
+
+static jerryxx_sequence_t jerryxx_sequences[JERRYXX_SEQUENCE_COUNT];
+static uint32_t jerryxx_sequence_active_count = 0;
+
+/**
+ * Half period of the square wave of a melody.
+ */
+static void
+jerryxx_sequence_wave_isr(jerryxx_sequence_t *sequence_p) /**< melody */
+{
+  sequence_p->high = !sequence_p->high;
+  jerryxx_gpio_write(&sequence_p->gpio, sequence_p->high ? HIGH : LOW);
+} /* jerryxx_sequence_wave_isr */
+
+/**
+ * End a melody, the pin is left low.
+ */
+static void
+jerryxx_sequence_end(jerryxx_sequence_t *sequence_p, /**< melody */
+                     bool completed)                 /**< all the notes played */
+{
+  sequence_p->wave.detach();
+  sequence_p->note.detach();
+  sequence_p->high = false;
+  jerryxx_gpio_write(&sequence_p->gpio, LOW);
+  sequence_p->completed = completed;
+  sequence_p->done = true;
+  jerryxx_scheduler_wake();
+} /* jerryxx_sequence_end */
+
+/**
+ * Start the next note of a melody, or end it after the last one.
+ */
+static void
+jerryxx_sequence_note_isr(jerryxx_sequence_t *sequence_p) /**< melody */
+{
+  sequence_p->wave.detach();
+  sequence_p->high = false;
+  jerryxx_gpio_write(&sequence_p->gpio, LOW);
+
+  if (sequence_p->index >= sequence_p->length)
+  {
+    jerryxx_sequence_end(sequence_p, true);
+    return;
+  }
+
+  uint32_t frequency = sequence_p->frequencies_p[sequence_p->index];
+  uint32_t duration = sequence_p->durations_p[sequence_p->index];
+  sequence_p->index++;
+
+  if (frequency != 0)
+  {
+    /* The array is read in place: a note raised after the start is clamped */
+    frequency = frequency < JERRYXX_SEQUENCE_FREQUENCY_MAX ? frequency : JERRYXX_SEQUENCE_FREQUENCY_MAX;
+    sequence_p->wave.attach(mbed::callback(jerryxx_sequence_wave_isr, sequence_p), std::chrono::microseconds(500000 / frequency));
+  }
+
+  sequence_p->note.attach(mbed::callback(jerryxx_sequence_note_isr, sequence_p), std::chrono::milliseconds(duration));
+} /* jerryxx_sequence_note_isr */
+
+/**
+ * Start a melody on a free slot.
+ *
+ * @return pointer to the melody - if the operation was successful,
+ *         NULL - if all the slots are in use or the pin already plays a melody.
+ */
+static jerryxx_sequence_t *
+jerryxx_sequence_start(jerry_value_t promise,           /**< Promise resolved at the end */
+                       uint32_t pin,                    /**< Arduino pin, checked by the caller */
+                       const jerry_value_t frequencies, /**< Uint16Array of the frequencies */
+                       const jerry_value_t durations,   /**< Uint16Array of the durations */
+                       const uint16_t *frequencies_p,   /**< data of frequencies */
+                       const uint16_t *durations_p,     /**< data of durations */
+                       uint32_t length)                 /**< number of notes */
+{
+  jerryxx_sequence_t *sequence_p = NULL;
+
+  for (uint32_t idx = 0; idx < JERRYXX_SEQUENCE_COUNT; idx++)
+  {
+    if (!jerryxx_sequences[idx].active)
+    {
+      sequence_p = sequence_p != NULL ? sequence_p : &jerryxx_sequences[idx];
+    }
+    else if (jerryxx_sequences[idx].pin == pin)
+    {
+      return NULL;
+    }
+  }
+
+  if (sequence_p == NULL)
+  {
+    return NULL;
+  }
+
+  /* The end is delivered by the event loop */
+  jerryxx_timer_wheel_init();
+
+  jerryxx_gpio_from_pin(pin, &sequence_p->gpio);
+  pinMode(pin, OUTPUT);
+
+  sequence_p->promise = jerry_value_copy(promise);
+  sequence_p->frequencies = jerry_value_copy(frequencies);
+  sequence_p->durations = jerry_value_copy(durations);
+  sequence_p->frequencies_p = frequencies_p;
+  sequence_p->durations_p = durations_p;
+  sequence_p->length = length;
+  sequence_p->pin = pin;
+  sequence_p->index = 0;
+  sequence_p->done = false;
+  sequence_p->active = true;
+  jerryxx_sequence_active_count++;
+
+  core_util_critical_section_enter();
+  jerryxx_sequence_note_isr(sequence_p);
+  core_util_critical_section_exit();
+
+  return sequence_p;
+} /* jerryxx_sequence_start */
+
+/**
+ * Stop the melody playing on a pin, its Promise is resolved with false.
+ *
+ * @return true - if a melody was playing on the pin,
+ *         false - otherwise.
+ */
+static bool
+jerryxx_sequence_stop(uint32_t pin) /**< Arduino pin */
+{
+  for (uint32_t idx = 0; idx < JERRYXX_SEQUENCE_COUNT; idx++)
+  {
+    jerryxx_sequence_t *sequence_p = &jerryxx_sequences[idx];
+
+    if (sequence_p->active && sequence_p->pin == pin)
+    {
+      core_util_critical_section_enter();
+      if (!sequence_p->done)
+      {
+        jerryxx_sequence_end(sequence_p, false);
+      }
+      core_util_critical_section_exit();
+      return true;
+    }
+  }
+
+  return false;
+} /* jerryxx_sequence_stop */
+
+/**
+ * Stop a melody and give its slot back, the caller owns its Promise.
+ */
+static void
+jerryxx_sequence_release(jerryxx_sequence_t *sequence_p) /**< melody */
+{
+  sequence_p->wave.detach();
+  sequence_p->note.detach();
+  jerry_value_free(sequence_p->frequencies);
+  jerry_value_free(sequence_p->durations);
+  sequence_p->active = false;
+  jerryxx_sequence_active_count--;
+} /* jerryxx_sequence_release */
+
+/**
+ * Find a melody which has ended.
+ *
+ * @return pointer to the melody - if one is waiting,
+ *         NULL - otherwise.
+ */
+static jerryxx_sequence_t *
+jerryxx_sequence_ready(void)
+{
+  for (uint32_t idx = 0; idx < JERRYXX_SEQUENCE_COUNT; idx++)
+  {
+    if (jerryxx_sequences[idx].active && jerryxx_sequences[idx].done)
+    {
+      return &jerryxx_sequences[idx];
+    }
+  }
+
+  return NULL;
+} /* jerryxx_sequence_ready */
+
+/**
+ * Resolve the Promise of a melody which has ended: true if all the notes
+ * played, false if it was stopped by noTone.
+ */
+static void
+jerryxx_sequence_deliver(jerryxx_sequence_t *sequence_p) /**< melody which has ended */
+{
+  jerry_value_t promise = sequence_p->promise;
+  jerry_value_t completed = jerry_boolean(sequence_p->completed);
+
+  jerryxx_sequence_release(sequence_p);
+  jerryxx_settle_promise(promise, completed, true);
+
+  jerry_value_free(completed);
+  jerry_value_free(promise);
+} /* jerryxx_sequence_deliver */
+
+/**
+ * PWM channel of a PwmOut object. The mbed PwmOut configures the pin and the
+ * channel once, the period is then set in timer clock ticks and the duty is
+ * written straight to the compare register of the channel.
+ */
+typedef struct jerryxx_pwm_s
+{
+  mbed::PwmOut *pwm_p;          /**< PWM output, NULL once closed */
+  TIM_TypeDef *tim_p;           /**< timer of the channel */
+  volatile uint32_t *ccr_p;     /**< compare register of the channel */
+  uint32_t psc;                 /**< prescaler, shared by all the channels of the timer */
+  uint32_t arr;                 /**< auto-reload, shared by all the channels of the timer */
+  float scale;                  /**< factor from a duty value to a fraction of the period */
+  struct jerryxx_pwm_s *next_p; /**< next open channel */
+} jerryxx_pwm_t;
+
+/**
+ * Open PwmOut channels, looked up for the period of their timer.
+ */
+static jerryxx_pwm_t *jerryxx_pwm_open_list = NULL;
+
+/**
+ * Find an open channel of a timer.
+ *
+ * @return pointer to the channel - if the timer drives an open PwmOut,
+ *         NULL - otherwise.
+ */
+static const jerryxx_pwm_t *
+jerryxx_pwm_find_timer(const TIM_TypeDef *tim_p) /**< timer */
+{
+  for (const jerryxx_pwm_t *pwm_p = jerryxx_pwm_open_list; pwm_p != NULL; pwm_p = pwm_p->next_p)
+  {
+    if (pwm_p->tim_p == tim_p)
+    {
+      return pwm_p;
+    }
+  }
+
+  return NULL;
+} /* jerryxx_pwm_find_timer */
+
+/**
+ * Close a PWM channel and remove it from the open channels.
+ */
+static void
+jerryxx_pwm_close(jerryxx_pwm_t *pwm_p) /**< channel */
+{
+  if (pwm_p->pwm_p == NULL)
+  {
+    return;
+  }
+
+  for (jerryxx_pwm_t **link_p = &jerryxx_pwm_open_list; *link_p != NULL; link_p = &(*link_p)->next_p)
+  {
+    if (*link_p == pwm_p)
+    {
+      *link_p = pwm_p->next_p;
+      break;
+    }
+  }
+
+  if (jerryxx_pwm_find_timer(pwm_p->tim_p) == NULL)
+  {
+    jerryxx_tim_set_user(pwm_p->tim_p, JERRYXX_TIM_FREE);
+  }
+
+  delete pwm_p->pwm_p;
+  pwm_p->pwm_p = NULL;
+} /* jerryxx_pwm_close */
+
+/**
+ * Set the duty cycle of a PWM channel.
+ */
+static void
+jerryxx_pwm_write(const jerryxx_pwm_t *pwm_p, /**< channel, not closed */
+                  double value)               /**< duty in the scale of the channel */
+{
+  float duty = (float)value * pwm_p->scale;
+
+  /* NaN fails both comparisons and counts as 0 */
+  duty = duty > 0.0f ? (duty < 1.0f ? duty : 1.0f) : 0.0f;
+
+  /* A compare value past the auto-reload keeps the output high */
+  *pwm_p->ccr_p = (uint32_t)(duty * (float)(pwm_p->tim_p->ARR + 1) + 0.5f);
+} /* jerryxx_pwm_write */
+
+/**
+ * Get the duty cycle of a PWM channel.
+ *
+ * @return duty in the scale of the channel
+ */
+static double
+jerryxx_pwm_read(const jerryxx_pwm_t *pwm_p) /**< channel, not closed */
+{
+  uint32_t ccr = *pwm_p->ccr_p;
+  uint32_t top = pwm_p->tim_p->ARR + 1;
+
+  return (double)(ccr < top ? ccr : top) / top / pwm_p->scale;
+} /* jerryxx_pwm_read */
+
+/**
+ * Free the channel of a collected PwmOut object.
+ */
+static void
+jerryxx_pwm_free(void *native_p,                     /**< channel */
+                 jerry_object_native_info_t *info_p) /**< type information */
+{
+  JERRYX_UNUSED(info_p);
+  jerryxx_pwm_t *pwm_p = (jerryxx_pwm_t *)native_p;
+
+  jerryxx_pwm_close(pwm_p);
+  delete pwm_p;
+} /* jerryxx_pwm_free */
+
+/**
+ * Type information of the PwmOut objects.
+ */
+static const jerry_object_native_info_t jerryxx_pwm_info = {jerryxx_pwm_free, 0, 0};
+
+/**
+ * Channels of a PwmGroup object. The PwmOut objects are kept alive by an
+ * internal property of the group.
+ */
+typedef struct
+{
+  uint32_t count;         /**< number of channels */
+  jerryxx_pwm_t **pwms_p; /**< channels */
+} jerryxx_pwm_group_t;
+
+/**
+ * Free the channels of a collected PwmGroup object.
+ */
+static void
+jerryxx_pwm_group_free(void *native_p,                     /**< group */
+                       jerry_object_native_info_t *info_p) /**< type information */
+{
+  JERRYX_UNUSED(info_p);
+  jerryxx_pwm_group_t *group_p = (jerryxx_pwm_group_t *)native_p;
+
+  delete[] group_p->pwms_p;
+  delete group_p;
+} /* jerryxx_pwm_group_free */
+
+/**
+ * Type information of the PwmGroup objects.
+ */
+static const jerry_object_native_info_t jerryxx_pwm_group_info = {jerryxx_pwm_group_free, 0, 0};
+
+/**
+ * Check whether the I/O lane has work waiting: ticker batches, interrupt
+ * batches, measurements, waveform passes or melodies.
+ *
+ * @return true - if a delivery is waiting,
+ *         false - otherwise.
+ */
+static bool
+jerryxx_io_is_ready(void)
+{
+  return jerryxx_ticker_ready() != NULL || jerryxx_interrupt_batch_is_ready() || jerryxx_pulse_ready() != NULL
+         || jerryxx_waveform_ready() != NULL || jerryxx_sequence_ready() != NULL;
+} /* jerryxx_io_is_ready */
+
+/**
+ * Count the deliveries waiting in the I/O lane: one per ticker batch,
+ * measurement, waveform pass, melody and pin with an interrupt batch.
+ *
+ * @return number of deliveries
+ */
+static uint32_t
+jerryxx_io_ready_count(void)
+{
+  uint32_t count = 0;
+
+  for (uint32_t idx = 0; idx < JERRYXX_TICKER_COUNT; idx++)
+  {
+    count += jerryxx_tickers[idx].active && jerryxx_tickers[idx].ready >= 0;
+  }
+
+  for (uint32_t idx = 0; idx < JERRYXX_PULSE_COUNT; idx++)
+  {
+    count += jerryxx_pulses[idx].active && jerryxx_pulses[idx].state == JERRYXX_PULSE_DONE;
+  }
+
+  for (uint32_t idx = 0; idx < JERRYXX_WAVEFORM_COUNT; idx++)
+  {
+    count += jerryxx_waveforms[idx].playing && jerryxx_waveforms[idx].passes != jerryxx_waveforms[idx].delivered;
+  }
+
+  for (uint32_t idx = 0; idx < JERRYXX_SEQUENCE_COUNT; idx++)
+  {
+    count += jerryxx_sequences[idx].active && jerryxx_sequences[idx].done;
+  }
+
+  for (uint32_t word = 0; word < JERRYXX_INTERRUPT_WORDS; word++)
+  {
+    count += (uint32_t)__builtin_popcount(jerryxx_interrupt_batch_ready[word]);
+  }
+
+  return count;
+} /* jerryxx_io_ready_count */
+
+/**
+ * Run one delivery of the I/O lane.
+ */
+static void
+jerryxx_io_dispatch(void)
+{
+  jerryxx_ticker_t *ticker_p = jerryxx_ticker_ready();
+
+  if (ticker_p != NULL)
+  {
+    jerryxx_ticker_deliver(ticker_p);
+    return;
+  }
+
+  jerryxx_pulse_t *pulse_p = jerryxx_pulse_ready();
+
+  if (pulse_p != NULL)
+  {
+    jerryxx_pulse_deliver(pulse_p);
+    return;
+  }
+
+  jerryxx_waveform_t *waveform_p = jerryxx_waveform_ready();
+
+  if (waveform_p != NULL)
+  {
+    jerryxx_waveform_deliver(waveform_p);
+    return;
+  }
+
+  jerryxx_sequence_t *sequence_p = jerryxx_sequence_ready();
+
+  if (sequence_p != NULL)
+  {
+    jerryxx_sequence_deliver(sequence_p);
+    return;
+  }
+
+  jerryxx_interrupt_batch_deliver();
+} /* jerryxx_io_dispatch */
+
+/**
+ * Get the counters of the edges queued by the pin interrupts.
+ */
+void jerryxx_get_interrupt_stats(jerryxx_interrupt_stats_t *stats_p) /**< [out] counters */
+{
+  core_util_critical_section_enter();
+  *stats_p = jerryxx_interrupt_stats;
+  stats_p->pending = jerryxx_interrupt_pending();
+  core_util_critical_section_exit();
+} /* jerryxx_get_interrupt_stats */
+
+/**
+ * Get the summaries of the latencies of the handlers of attachInterrupt.
+ */
+void jerryxx_get_interrupt_latency(jerryxx_latency_summary_t summaries[JERRYXX_LATENCY_COUNT]) /**< [out] summary per stage */
+{
+  for (uint32_t stage = 0; stage < JERRYXX_LATENCY_COUNT; stage++)
+  {
+    const jerryxx_latency_t *latency_p = &jerryxx_interrupt_latency[stage];
+    jerryxx_latency_summary_t *summary_p = &summaries[stage];
+
+    summary_p->count = latency_p->count;
+    summary_p->min = latency_p->min;
+    summary_p->max = latency_p->max;
+    summary_p->avg = latency_p->count != 0 ? (uint32_t)(latency_p->sum / latency_p->count) : 0;
+    summary_p->p99 = 0;
+
+    /* Upper bound of the bucket holding the 99th percentile, at most the maximum */
+    uint32_t rank = (uint32_t)(((uint64_t)latency_p->count * 99 + 99) / 100);
+    uint32_t seen = 0;
+
+    for (uint32_t bucket = 0; rank != 0 && bucket < JERRYXX_LATENCY_BUCKETS; bucket++)
+    {
+      seen += latency_p->histogram[bucket];
+
+      if (seen >= rank)
+      {
+        uint32_t bound = jerryxx_latency_bucket_max(bucket);
+        summary_p->p99 = bound < latency_p->max ? bound : latency_p->max;
+        break;
+      }
+    }
+  }
+} /* jerryxx_get_interrupt_latency */
+
+/**
+ * Reset the latencies of the handlers of attachInterrupt.
+ */
+void jerryxx_reset_interrupt_latency(void)
+{
+  memset(jerryxx_interrupt_latency, 0, sizeof(jerryxx_interrupt_latency));
+} /* jerryxx_reset_interrupt_latency */
+
+/**
+ * Number of times a lane with work waiting has been passed over by the higher lanes.
+ */
+static uint32_t jerryxx_lane_skipped[JERRYXX_LANE_COUNT];
+
+/**
+ * Choose the lane of the next callback: the highest non-empty one, unless
+ * a lower lane has been passed over JERRYXX_LANE_STARVATION_LIMIT times.
+ * The interrupt and I/O lanes only serve the work they had when the pass began.
+ *
+ * @return jerryxx_lane_t - of the next callback,
+ *         -1 - if all the lanes are empty.
+ */
+static int32_t
+jerryxx_lane_pick(uint32_t interrupt_head, /**< head of the interrupt queue when the pass began */
+                  uint32_t io_budget)      /**< I/O deliveries left in the pass */
+{
+  bool ready[JERRYXX_LANE_COUNT];
+  ready[JERRYXX_LANE_INTERRUPT] = (int32_t)(interrupt_head - jerryxx_interrupt_tail) > 0;
+  ready[JERRYXX_LANE_IO] = io_budget != 0 && jerryxx_io_is_ready();
+  ready[JERRYXX_LANE_TIMER] = !jerryxx_timer_list_is_empty(&jerryxx_timer_batch);
+  ready[JERRYXX_LANE_IDLE] = !jerryxx_timer_list_is_empty(&jerryxx_idle_batch);
+
+  int32_t pick = -1;
+  int32_t promoted = -1;
+
+  for (int32_t lane = 0; lane < JERRYXX_LANE_COUNT; lane++)
+  {
+    if (!ready[lane])
+    {
+      continue;
+    }
+
+    if (pick < 0)
+    {
+      pick = lane;
+    }
+    else if (++jerryxx_lane_skipped[lane] > JERRYXX_LANE_STARVATION_LIMIT && promoted < 0)
+    {
+      promoted = lane;
+    }
+  }
+
+  if (promoted >= 0)
+  {
+    jerryxx_loop_stats.lanes[promoted].promoted++;
+    pick = promoted;
+  }
+
+  if (pick >= 0)
+  {
+    jerryxx_lane_skipped[pick] = 0;
+    jerryxx_loop_stats.lanes[pick].dispatched++;
+  }
+
+  return pick;
+} /* jerryxx_lane_pick */
+
+/**
+ * Account a new batch of expired timers: lag of the pass and depth of the backlog.
+ */
+static void
+jerryxx_timer_batch_begin(void)
+{
+  jerryxx_loop_backlog = 0;
+
+  if (jerryxx_timer_list_is_empty(&jerryxx_timer_batch))
+  {
+    return;
+  }
+
+  /* Lag: how long the oldest expired timer waited for this pass */
+  uint64_t now = jerryxx_clock_us();
+  uint64_t oldest = now;
+
+  for (jerryxx_timer_link_t *link_p = jerryxx_timer_batch.next_p; link_p != &jerryxx_timer_batch; link_p = link_p->next_p)
+  {
+    jerryxx_timer_t *timer_p = (jerryxx_timer_t *)link_p;
+    oldest = timer_p->deadline < oldest ? timer_p->deadline : oldest;
+    jerryxx_loop_backlog++;
+  }
+
+  uint32_t lag = (uint32_t)(now - oldest < UINT32_MAX ? now - oldest : UINT32_MAX);
+  jerryxx_loop_stats.last_lag = lag;
+
+  if (lag > jerryxx_loop_stats.max_lag)
+  {
+    jerryxx_loop_stats.max_lag = lag;
+  }
+
+  if (jerryxx_loop_backlog > jerryxx_loop_stats.max_pending_callbacks)
+  {
+    jerryxx_loop_stats.max_pending_callbacks = jerryxx_loop_backlog;
+  }
+} /* jerryxx_timer_batch_begin */
+
+/**
+ * Run the callback of the first expired timer of the batch, then re-arm or release it.
+ */
+static void
+jerryxx_timer_fire(void)
+{
+  jerryxx_timer_t *timer_p = (jerryxx_timer_t *)jerryxx_timer_batch.next_p;
+  jerryxx_timer_list_remove(&timer_p->link);
+  timer_p->state = JERRYXX_TIMER_RUNNING;
+  jerryxx_loop_backlog--;
+
+  uint64_t lateness = jerryxx_clock_us() - timer_p->deadline;
+  if (lateness > timer_p->max_lateness)
+  {
+    timer_p->max_lateness = (uint32_t)(lateness < UINT32_MAX ? lateness : UINT32_MAX);
+  }
+  jerryxx_loop_stats_lateness(lateness);
+  timer_p->fired++;
+
+  /* Moved by its slack onto the tick of other timers: one wake-up served them all */
+  if (timer_p->aligned && timer_p->shared)
+  {
+    timer_p->coalesced++;
+    jerryxx_loop_stats.coalesced++;
+  }
+
+  if (timer_p->kind == JERRYXX_TIMER_PROMISE)
+  {
+    jerry_value_t undefined_val = jerry_undefined();
+    jerryxx_settle_promise(timer_p->callback_fn, undefined_val, true);
+    jerry_value_free(undefined_val);
+  }
+  else
+  {
+    /* Coalesced intervals receive the number of periods elapsed since the previous call */
+    jerry_value_t ticks_val = jerry_number(timer_p->ticks);
+    jerryxx_call_callback(timer_p->callback_fn, &ticks_val, timer_p->policy == JERRYXX_INTERVAL_COALESCE ? 1 : 0);
+    jerry_value_free(ticks_val);
+  }
+
+  if (timer_p->interval != 0 && !timer_p->cancelled)
+  {
+    jerryxx_timer_rearm(timer_p);
+  }
+  else
+  {
+    jerryxx_timer_release(timer_p);
+  }
+} /* jerryxx_timer_fire */
+
+/**
+ * Run the first idle callback of the batch and release it.
+ */
+static void
+jerryxx_idle_fire(void)
+{
+  jerryxx_timer_t *timer_p = (jerryxx_timer_t *)jerryxx_idle_batch.next_p;
+  jerryxx_timer_list_remove(&timer_p->link);
+  timer_p->state = JERRYXX_TIMER_RUNNING;
+  timer_p->fired++;
+
+  jerryxx_call_callback(timer_p->callback_fn, NULL, 0);
+  jerryxx_timer_release(timer_p);
+} /* jerryxx_idle_fire */
+
+/**
+ * Run JavaScript scheduler: call the callbacks of the pending events, one at
+ * a time from the highest non-empty lane: interrupts, I/O (ticker and
+ * interrupt batches, measurements, waveform passes, melodies), timers, idle.
+ * A pass serves only the work waiting when it began, so a stream of edges
+ * cannot hold back the timers; the caller runs the next pass.
+ * Must be called from the thread which owns the engine.
+ *
+ * @return true - if there are timers, tickers, interrupt handlers, measurements, waveforms or melodies still pending,
+ *         false - otherwise.
+ */
+bool jerryxx_scheduler_yield(void)
+{
+  if (!jerryxx_timer_wheel_ready)
+  {
+    return false;
+  }
+
+  jerryxx_timer_wheel_advance(jerryxx_clock_us() / 1000);
+
+  /* Timers and idle callbacks queued by the callbacks run on the next pass */
+  jerryxx_timer_list_splice(&jerryxx_timer_batch, &jerryxx_timer_due);
+  jerryxx_timer_list_splice(&jerryxx_idle_batch, &jerryxx_idle_queue);
+  jerryxx_timer_batch_begin();
+
+  /* Edges and deliveries arriving during the pass wait for the next one */
+  uint32_t interrupt_head = jerryxx_interrupt_head;
+  uint32_t io_budget = jerryxx_io_ready_count();
+  int32_t lane;
+
+  while ((lane = jerryxx_lane_pick(interrupt_head, io_budget)) >= 0)
+  {
+    switch (lane)
+    {
+      case JERRYXX_LANE_INTERRUPT:
+        jerryxx_interrupt_dispatch();
+        break;
+      case JERRYXX_LANE_IO:
+        jerryxx_io_dispatch();
+        io_budget--;
+        break;
+      case JERRYXX_LANE_TIMER:
+        jerryxx_timer_fire();
+        break;
+      default:
+        jerryxx_idle_fire();
+        break;
+    }
+  }
+
+  return (jerryxx_timer_armed_count != 0 || jerryxx_ticker_active_count != 0 || jerryxx_interrupt_attached_count != 0
+          || jerryxx_pulse_active_count != 0 || jerryxx_waveform_playing_count != 0 || jerryxx_sequence_active_count != 0);
+} /* jerryxx_scheduler_yield */
+
+/**
+ * Wake up the event loop from its idle wait. Safe to call from interrupts.
+ */
+void jerryxx_scheduler_wake(void)
+{
+  jerryxx_event_flags.set(JERRYXX_EVENT_FLAG_WAKE);
+} /* jerryxx_scheduler_wake */
+
+/**
+ * Block the engine thread on the wake event flag until the next timer
+ * expires, or at most for the given time. No tick runs while waiting,
+ * so the MCU can stay in the low power mode between the events.
+ */
+void jerryxx_scheduler_idle(uint32_t timeout_ms) /**< maximum wait, JERRYXX_IDLE_FOREVER to wait only for timers and events */
+{
+  uint64_t now = jerryxx_clock_us();
+  uint64_t target = UINT64_MAX;
+
+  if (jerryxx_timer_wheel_ready)
+  {
+    /* Work left for the next pass of the scheduler */
+    if (!jerryxx_timer_list_is_empty(&jerryxx_idle_queue) || jerryxx_interrupt_pending() != 0 || jerryxx_io_is_ready())
+    {
+      return;
+    }
+
+    uint64_t next = jerryxx_timer_wheel_next_tick();
+
+    if (next != UINT64_MAX)
+    {
+      target = next * 1000;
+    }
+  }
+
+  if (timeout_ms != JERRYXX_IDLE_FOREVER && now + (uint64_t)timeout_ms * 1000 < target)
+  {
+    target = now + (uint64_t)timeout_ms * 1000;
+  }
+
+  if (target <= now)
+  {
+    return;
+  }
+
+  uint32_t flags;
+
+  if (target == UINT64_MAX)
+  {
+    flags = jerryxx_event_flags.wait_any(JERRYXX_EVENT_FLAG_WAKE);
+  }
+  else
+  {
+    flags = jerryxx_event_flags.wait_any_for(JERRYXX_EVENT_FLAG_WAKE, std::chrono::milliseconds((target - now + 999) / 1000));
+  }
+
+  uint64_t woken = jerryxx_clock_us();
+
+  jerryxx_idle_stats.sleeps++;
+  jerryxx_idle_stats.idle_time += woken - now;
+
+  if (flags & osFlagsError)
+  {
+    /* Timed out: how late the thread was resumed */
+    uint32_t latency = (uint32_t)(woken > target ? woken - target : 0);
+    jerryxx_idle_stats.last_wake_latency = latency;
+
+    if (latency > jerryxx_idle_stats.max_wake_latency)
+    {
+      jerryxx_idle_stats.max_wake_latency = latency;
+    }
+  }
+  else
+  {
+    jerryxx_idle_stats.event_wakeups++;
+  }
+} /* jerryxx_scheduler_idle */
+
+/**
+ * Get the counters of the idle time of the event loop.
+ */
+void jerryxx_get_idle_stats(jerryxx_idle_stats_t *stats_p) /**< [out] counters */
+{
+  *stats_p = jerryxx_idle_stats;
+} /* jerryxx_get_idle_stats */
+
+/**
+ * Get the counters of the work done by the event loop.
+ */
+void jerryxx_get_loop_stats(jerryxx_loop_stats_t *stats_p) /**< [out] counters */
+{
+  *stats_p = jerryxx_loop_stats;
+  stats_p->pending_timers = jerryxx_timer_armed_count;
+
+  jerryxx_lane_stats_t *lanes_p = stats_p->lanes;
+  lanes_p[JERRYXX_LANE_INTERRUPT].pending = jerryxx_interrupt_pending();
+  lanes_p[JERRYXX_LANE_IO].pending = jerryxx_io_ready_count();
+  lanes_p[JERRYXX_LANE_TIMER].pending = jerryxx_loop_backlog;
+  lanes_p[JERRYXX_LANE_IDLE].pending = 0;
+
+  if (jerryxx_timer_wheel_ready)
+  {
+    for (jerryxx_timer_link_t *link_p = jerryxx_timer_due.next_p; link_p != &jerryxx_timer_due; link_p = link_p->next_p)
+    {
+      lanes_p[JERRYXX_LANE_TIMER].pending++;
+    }
+
+    jerryxx_timer_link_t *lists[] = {&jerryxx_idle_queue, &jerryxx_idle_batch};
+
+    for (uint32_t idx = 0; idx < JERRYXX_ARRAY_SIZE(lists); idx++)
+    {
+      for (jerryxx_timer_link_t *link_p = lists[idx]->next_p; link_p != lists[idx]; link_p = link_p->next_p)
+      {
+        lanes_p[JERRYXX_LANE_IDLE].pending++;
+      }
+    }
+  }
+
+  stats_p->pending_callbacks = 0;
+
+  for (uint32_t lane = 0; lane < JERRYXX_LANE_COUNT; lane++)
+  {
+    stats_p->pending_callbacks += lanes_p[lane].pending;
+  }
+} /* jerryxx_get_loop_stats */
+
+/**
+ * Reset the counters of the event loop, of its idle time and of the callback budget.
+ */
+void jerryxx_reset_loop_stats(void)
+{
+  memset(&jerryxx_loop_stats, 0, sizeof(jerryxx_loop_stats));
+  memset(&jerryxx_idle_stats, 0, sizeof(jerryxx_idle_stats));
+  jerryxx_budget_overruns = 0;
+} /* jerryxx_reset_loop_stats */
+
+/**
+ * Run JavaScript event loop until there are no more pending timers.
+ * Must be called from the thread which owns the engine.
+ *
+ * @return true - if the operation was successful,
+ *         false - otherwise.
+ */
+bool jerryxx_run_event_loop(void)
+{
+  /* Continuations of the script which started the loop */
+  jerryxx_run_jobs();
+
+  while (jerryxx_scheduler_yield())
+  {
+    jerryxx_scheduler_idle(JERRYXX_IDLE_FOREVER);
+  }
+
+  return true;
+} /* jerryxx_run_event_loop */
+
+/**
+ * Pin change queued by digitalWriteAt.
+ */
+typedef struct
+{
+  uint64_t at;         /**< absolute time of the change in microseconds */
+  jerryxx_gpio_t gpio; /**< registers of the pin */
+  uint32_t seq;        /**< order of insertion, keeps the changes at the same time in order */
+  uint8_t value;       /**< HIGH or LOW */
+} jerryxx_gpio_action_t;
+
+/**
+ * Min-heap of the pending changes, shared with the interrupt of the hardware timer:
+ * the engine thread changes it inside critical sections.
+ */
+static jerryxx_gpio_action_t jerryxx_gpio_actions[JERRYXX_GPIO_ACTION_QUEUE_SIZE];
+static jerryxx_gpio_action_t jerryxx_gpio_batch[JERRYXX_GPIO_ACTION_QUEUE_SIZE];
+static volatile uint32_t jerryxx_gpio_action_count = 0;
+static uint32_t jerryxx_gpio_action_seq = 0;
+static mbed::Timeout jerryxx_gpio_timeout;
+static jerryxx_gpio_action_stats_t jerryxx_gpio_action_stats;
+
+/**
+ * Order of the actions in the heap.
+ *
+ * @return true - if the first action runs before the second one,
+ *         false - otherwise.
+ */
+static inline bool
+jerryxx_gpio_action_before(const jerryxx_gpio_action_t *a_p, /**< first action */
+                           const jerryxx_gpio_action_t *b_p) /**< second action */
+{
+  return a_p->at < b_p->at || (a_p->at == b_p->at && (int32_t)(a_p->seq - b_p->seq) < 0);
+} /* jerryxx_gpio_action_before */
+
+/**
+ * Insert an action in the heap, the caller checks the room left.
+ */
+static void
+jerryxx_gpio_action_push(const jerryxx_gpio_action_t *action_p) /**< action to insert */
+{
+  uint32_t idx = jerryxx_gpio_action_count++;
+
+  while (idx > 0)
+  {
+    uint32_t parent = (idx - 1) / 2;
+
+    if (!jerryxx_gpio_action_before(action_p, &jerryxx_gpio_actions[parent]))
+    {
+      break;
+    }
+
+    jerryxx_gpio_actions[idx] = jerryxx_gpio_actions[parent];
+    idx = parent;
+  }
+
+  jerryxx_gpio_actions[idx] = *action_p;
+} /* jerryxx_gpio_action_push */
+
+/**
+ * Remove the earliest action from the heap, which must not be empty.
+ */
+static void
+jerryxx_gpio_action_pop(jerryxx_gpio_action_t *action_p) /**< [out] earliest action */
+{
+  *action_p = jerryxx_gpio_actions[0];
+
+  uint32_t count = --jerryxx_gpio_action_count;
+  jerryxx_gpio_action_t *last_p = &jerryxx_gpio_actions[count];
+  uint32_t idx = 0;
+
+  while (true)
+  {
+    uint32_t child = idx * 2 + 1;
+
+    if (child >= count)
+    {
+      break;
+    }
+
+    if (child + 1 < count && jerryxx_gpio_action_before(&jerryxx_gpio_actions[child + 1], &jerryxx_gpio_actions[child]))
+    {
+      child++;
+    }
+
+    if (!jerryxx_gpio_action_before(&jerryxx_gpio_actions[child], last_p))
+    {
+      break;
+    }
+
+    jerryxx_gpio_actions[idx] = jerryxx_gpio_actions[child];
+    idx = child;
+  }
+
+  jerryxx_gpio_actions[idx] = *last_p;
+} /* jerryxx_gpio_action_pop */
+
+static void jerryxx_gpio_action_isr(void);
+
+/**
+ * Program the hardware timer for the earliest pending action.
+ */
+static void
+jerryxx_gpio_action_reschedule(uint64_t now) /**< current time in microseconds */
+{
+  if (jerryxx_gpio_action_count == 0)
+  {
+    jerryxx_gpio_timeout.detach();
+    return;
+  }
+
+  uint64_t at = jerryxx_gpio_actions[0].at;
+  jerryxx_gpio_timeout.attach(jerryxx_gpio_action_isr, std::chrono::microseconds(at > now ? at - now : 0));
+} /* jerryxx_gpio_action_reschedule */
+
+/**
+ * Interrupt of the hardware timer: apply the expired actions. The actions
+ * due within JERRYXX_GPIO_ACTION_SPIN_US are awaited spinning, which is
+ * more accurate than another interrupt.
+ */
+static void
+jerryxx_gpio_action_isr(void)
+{
+  uint64_t now = jerryxx_clock_us();
+
+  while (jerryxx_gpio_action_count != 0 && jerryxx_gpio_actions[0].at <= now + JERRYXX_GPIO_ACTION_SPIN_US)
+  {
+    jerryxx_gpio_action_t action;
+    jerryxx_gpio_action_pop(&action);
+
+    while ((now = jerryxx_clock_us()) < action.at)
+    {
+    }
+
+    jerryxx_gpio_write(&action.gpio, action.value);
+
+    uint32_t error = (uint32_t)(now - action.at < UINT32_MAX ? now - action.at : UINT32_MAX);
+    jerryxx_gpio_action_stats.fired++;
+
+    if (error > jerryxx_gpio_action_stats.max_error)
+    {
+      jerryxx_gpio_action_stats.max_error = error;
+    }
+  }
+
+  jerryxx_gpio_action_reschedule(now);
+} /* jerryxx_gpio_action_isr */
+
+/**
+ * Convert a value of micros() into the clock of the scheduler, times
+ * already past are moved to now.
+ *
+ * @return true - if the time is in the future,
+ *         false - if it is already past.
+ */
+static bool
+jerryxx_gpio_action_time(uint32_t at_micros, /**< time as returned by micros(), may have wrapped */
+                         uint64_t *at_p)     /**< [out] absolute time in microseconds */
+{
+  int32_t delta = (int32_t)(at_micros - (uint32_t)micros());
+  uint64_t now = jerryxx_clock_us();
+
+  *at_p = delta > 0 ? now + (uint64_t)delta : now;
+
+  return delta >= 0;
+} /* jerryxx_gpio_action_time */
+
+/**
+ * Queue a batch of actions on the hardware timer, all of them or none.
+ *
+ * @return true - if the operation was successful,
+ *         false - if the queue has not enough room.
+ */
+static bool
+jerryxx_gpio_action_schedule(jerryxx_gpio_action_t actions_p[], /**< actions to queue */
+                             uint32_t count,                    /**< number of actions */
+                             uint32_t late)                     /**< number of actions already past their time */
+{
+  core_util_critical_section_enter();
+
+  if (count > JERRYXX_GPIO_ACTION_QUEUE_SIZE - jerryxx_gpio_action_count)
+  {
+    core_util_critical_section_exit();
+    return false;
+  }
+
+  uint64_t first = jerryxx_gpio_action_count != 0 ? jerryxx_gpio_actions[0].at : UINT64_MAX;
+
+  for (uint32_t idx = 0; idx < count; idx++)
+  {
+    actions_p[idx].seq = jerryxx_gpio_action_seq++;
+    jerryxx_gpio_action_push(&actions_p[idx]);
+  }
+
+  jerryxx_gpio_action_stats.queued += count;
+  jerryxx_gpio_action_stats.late += late;
+
+  if (jerryxx_gpio_actions[0].at < first)
+  {
+    jerryxx_gpio_action_reschedule(jerryxx_clock_us());
+  }
+
+  core_util_critical_section_exit();
+
+  return true;
+} /* jerryxx_gpio_action_schedule */
+
+/**
+ * Get the counters of the pin changes scheduled by digitalWriteAt.
+ */
+void jerryxx_get_gpio_action_stats(jerryxx_gpio_action_stats_t *stats_p) /**< [out] counters */
+{
+  core_util_critical_section_enter();
+  *stats_p = jerryxx_gpio_action_stats;
+  stats_p->pending = jerryxx_gpio_action_count;
+  core_util_critical_section_exit();
+} /* jerryxx_get_gpio_action_stats */
+
+/**
+ * Quadrature encoder of an Encoder object. The raw counter is the counter of
+ * a timer in encoder mode, or a software counter updated by the interrupts of
+ * the two pins; a ticker extends it to 64 bits and measures the velocity.
+ */
+typedef struct
+{
+  mbed::Ticker sampler;     /**< periodic extension of the raw counter */
+  TIM_TypeDef *tim_p;       /**< timer in encoder mode, NULL for the interrupt decoder */
+  mbed::InterruptIn *a_p;   /**< interrupts of the pin A, interrupt decoder */
+  mbed::InterruptIn *b_p;   /**< interrupts of the pin B, interrupt decoder */
+  uint8_t pin_a;            /**< Arduino pin A, interrupt decoder */
+  uint8_t pin_b;            /**< Arduino pin B, interrupt decoder */
+  jerryxx_gpio_t a;         /**< pin A */
+  jerryxx_gpio_t b;         /**< pin B */
+  uint8_t shift;            /**< 32 minus the width of the raw counter in bits */
+  uint8_t state;            /**< last levels of the pins A and B, interrupt decoder */
+  int8_t direction;         /**< -1 when the pins are wired to the channels of the timer swapped, 1 otherwise */
+  bool active;              /**< hardware still attached */
+  volatile uint32_t raw;    /**< software counter of the interrupt decoder */
+  volatile uint32_t errors; /**< transitions with both pins changed, interrupt decoder */
+  uint32_t last_raw;        /**< raw counter at the last sample */
+  int32_t last_delta;       /**< counts during the last sample period */
+  int64_t position;         /**< position at the last sample */
+  uint32_t overflows;       /**< times the raw counter wrapped around */
+} jerryxx_encoder_t;
+
+/**
+ * Steps of the interrupt decoder, indexed by the previous and the new levels
+ * of the pins A and B; 2 marks an invalid transition.
+ */
+static const int8_t jerryxx_encoder_steps[16] = {0, -1, 1, 2, 1, 0, 2, -1, -1, 2, 0, 1, 2, 1, -1, 0};
+
+/**
+ * Interrupt of the pin A or B of the interrupt decoder.
+ */
+static void
+jerryxx_encoder_edge_isr(jerryxx_encoder_t *encoder_p) /**< encoder */
+{
+  uint8_t state = (uint8_t)((jerryxx_gpio_read(&encoder_p->a) << 1) | jerryxx_gpio_read(&encoder_p->b));
+  int8_t step = jerryxx_encoder_steps[(encoder_p->state << 2) | state];
+  encoder_p->state = state;
+
+  if (step == 2)
+  {
+    encoder_p->errors++;
+    return;
+  }
+
+  encoder_p->raw += (uint32_t)(int32_t)step;
+} /* jerryxx_encoder_edge_isr */
+
+/**
+ * Counts since the last sample, the raw counter must be read with the
+ * interrupts disabled or from the sampler.
+ *
+ * @return signed number of counts
+ */
+static int32_t
+jerryxx_encoder_delta(const jerryxx_encoder_t *encoder_p, /**< encoder */
+                      uint32_t raw)                       /**< current raw counter */
+{
+  return (int32_t)((raw - encoder_p->last_raw) << encoder_p->shift) >> encoder_p->shift;
+} /* jerryxx_encoder_delta */
+
+/**
+ * Read the raw counter of an encoder.
+ *
+ * @return raw counter
+ */
+static inline uint32_t
+jerryxx_encoder_raw(const jerryxx_encoder_t *encoder_p) /**< encoder */
+{
+  return encoder_p->tim_p != NULL ? encoder_p->tim_p->CNT : encoder_p->raw;
+} /* jerryxx_encoder_raw */
+
+/**
+ * Interrupt of the sampler of an encoder: fold the counts of the period into
+ * the position before the raw counter can wrap around twice.
+ */
+static void
+jerryxx_encoder_sample_isr(jerryxx_encoder_t *encoder_p) /**< encoder */
+{
+  uint32_t raw = jerryxx_encoder_raw(encoder_p);
+  int32_t delta = jerryxx_encoder_delta(encoder_p, raw);
+  int64_t unwrapped = (int64_t)encoder_p->last_raw + delta;
+
+  if (unwrapped < 0 || unwrapped > (int64_t)(UINT32_MAX >> encoder_p->shift))
+  {
+    encoder_p->overflows++;
+  }
+
+  encoder_p->last_raw = raw;
+  encoder_p->last_delta = delta * encoder_p->direction;
+  encoder_p->position += encoder_p->last_delta;
+} /* jerryxx_encoder_sample_isr */
+
+/**
+ * Enable the clock of a timer which supports the encoder mode.
+ *
+ * @return true - if the operation was successful,
+ *         false - if the timer cannot be used.
+ */
+static bool
+jerryxx_encoder_clock(TIM_TypeDef *tim_p) /**< timer */
+{
+#if defined(TIM_MST)
+  if (tim_p == TIM_MST)
+  {
+    /* The timer of the microsecond ticker */
+    return false;
+  }
+#endif /* defined(TIM_MST) */
+
+#if defined(TIM1)
+  if (tim_p == TIM1)
+  {
+    __HAL_RCC_TIM1_CLK_ENABLE();
+    return true;
+  }
+#endif /* defined(TIM1) */
+#if defined(TIM2)
+  if (tim_p == TIM2)
+  {
+    __HAL_RCC_TIM2_CLK_ENABLE();
+    return true;
+  }
+#endif /* defined(TIM2) */
+#if defined(TIM3)
+  if (tim_p == TIM3)
+  {
+    __HAL_RCC_TIM3_CLK_ENABLE();
+    return true;
+  }
+#endif /* defined(TIM3) */
+#if defined(TIM4)
+  if (tim_p == TIM4)
+  {
+    __HAL_RCC_TIM4_CLK_ENABLE();
+    return true;
+  }
+#endif /* defined(TIM4) */
+#if defined(TIM5)
+  if (tim_p == TIM5)
+  {
+    __HAL_RCC_TIM5_CLK_ENABLE();
+    return true;
+  }
+#endif /* defined(TIM5) */
+#if defined(TIM8)
+  if (tim_p == TIM8)
+  {
+    __HAL_RCC_TIM8_CLK_ENABLE();
+    return true;
+  }
+#endif /* defined(TIM8) */
+
+  return false;
+} /* jerryxx_encoder_clock */
+
+/**
+ * Put the timer shared by the two pins in encoder mode, when they are its
+ * channels 1 and 2.
+ *
+ * @return true - if the operation was successful,
+ *         false - if the pins need the interrupt decoder.
+ */
+static bool
+jerryxx_encoder_timer_init(jerryxx_encoder_t *encoder_p, /**< encoder */
+                           uint32_t pin_a,               /**< Arduino pin A */
+                           uint32_t pin_b)               /**< Arduino pin B */
+{
+  PinName name_a = digitalPinToPinName((pin_size_t)pin_a);
+  PinName name_b = digitalPinToPinName((pin_size_t)pin_b);
+  /* pinmap_peripheral stops the board on a pin without timer */
+  uint32_t tim_a = pinmap_find_peripheral(name_a, PinMap_PWM);
+  uint32_t tim_b = pinmap_find_peripheral(name_b, PinMap_PWM);
+
+  if (tim_a == (uint32_t)NC || tim_a != tim_b)
+  {
+    return false;
+  }
+
+  uint32_t function_a = pinmap_find_function(name_a, PinMap_PWM);
+  uint32_t function_b = pinmap_find_function(name_b, PinMap_PWM);
+  uint32_t channels = (STM_PIN_CHANNEL(function_a) << 4) | STM_PIN_CHANNEL(function_b);
+
+  if (STM_PIN_INVERTED(function_a) || STM_PIN_INVERTED(function_b) || (channels != 0x12 && channels != 0x21))
+  {
+    return false;
+  }
+
+  TIM_TypeDef *tim_p = (TIM_TypeDef *)(uintptr_t)tim_a;
+
+  /* Another Encoder or PwmOut channels already program the timer */
+  if (jerryxx_tim_user(tim_p) != JERRYXX_TIM_FREE || !jerryxx_encoder_clock(tim_p))
+  {
+    return false;
+  }
+
+  pin_function(name_a, (int)function_a);
+  pin_function(name_b, (int)function_b);
+
+  /* Count both edges of both inputs, with a short input filter */
+  tim_p->CR1 = 0;
+  tim_p->SMCR = (tim_p->SMCR & ~TIM_SMCR_SMS) | TIM_SMCR_SMS_0 | TIM_SMCR_SMS_1;
+  tim_p->CCMR1 = TIM_CCMR1_CC1S_0 | TIM_CCMR1_CC2S_0 | (3UL << TIM_CCMR1_IC1F_Pos) | (3UL << TIM_CCMR1_IC2F_Pos);
+  tim_p->CCER = 0;
+  tim_p->PSC = 0;
+  tim_p->ARR = IS_TIM_32B_COUNTER_INSTANCE(tim_p) ? UINT32_MAX : UINT16_MAX;
+  tim_p->CNT = 0;
+  tim_p->CR1 = TIM_CR1_CEN;
+  jerryxx_tim_set_user(tim_p, JERRYXX_TIM_ENCODER);
+
+  encoder_p->tim_p = tim_p;
+  encoder_p->shift = IS_TIM_32B_COUNTER_INSTANCE(tim_p) ? 0 : 16;
+  encoder_p->direction = channels == 0x12 ? 1 : -1;
+  return true;
+} /* jerryxx_encoder_timer_init */
+
+/**
+ * Start counting the quadrature signal of two pins, checked by the caller.
+ *
+ * @return true - if the operation was successful,
+ *         false - if the pins need the interrupt decoder and an EXTI line is in use.
+ */
+static bool
+jerryxx_encoder_init(jerryxx_encoder_t *encoder_p, /**< encoder */
+                     uint32_t pin_a,               /**< Arduino pin A */
+                     uint32_t pin_b)               /**< Arduino pin B */
+{
+  encoder_p->tim_p = NULL;
+  encoder_p->a_p = NULL;
+  encoder_p->b_p = NULL;
+  encoder_p->shift = 0;
+  encoder_p->direction = 1;
+  encoder_p->raw = 0;
+  encoder_p->errors = 0;
+  encoder_p->last_raw = 0;
+  encoder_p->last_delta = 0;
+  encoder_p->position = 0;
+  encoder_p->overflows = 0;
+
+  jerryxx_gpio_from_pin(pin_a, &encoder_p->a);
+  jerryxx_gpio_from_pin(pin_b, &encoder_p->b);
+
+  if (!jerryxx_encoder_timer_init(encoder_p, pin_a, pin_b))
+  {
+    if (!jerryxx_exti_is_free(pin_a) || !jerryxx_exti_is_free(pin_b) || jerryxx_exti_mask(pin_a) == jerryxx_exti_mask(pin_b))
+    {
+      return false;
+    }
+
+    jerryxx_exti_claim(pin_a);
+    jerryxx_exti_claim(pin_b);
+    encoder_p->pin_a = (uint8_t)pin_a;
+    encoder_p->pin_b = (uint8_t)pin_b;
+    encoder_p->a_p = new mbed::InterruptIn(digitalPinToPinName((pin_size_t)pin_a));
+    encoder_p->b_p = new mbed::InterruptIn(digitalPinToPinName((pin_size_t)pin_b));
+    encoder_p->state = (uint8_t)((jerryxx_gpio_read(&encoder_p->a) << 1) | jerryxx_gpio_read(&encoder_p->b));
+    encoder_p->a_p->rise(mbed::callback(jerryxx_encoder_edge_isr, encoder_p));
+    encoder_p->a_p->fall(mbed::callback(jerryxx_encoder_edge_isr, encoder_p));
+    encoder_p->b_p->rise(mbed::callback(jerryxx_encoder_edge_isr, encoder_p));
+    encoder_p->b_p->fall(mbed::callback(jerryxx_encoder_edge_isr, encoder_p));
+  }
+
+  encoder_p->active = true;
+  encoder_p->sampler.attach(mbed::callback(jerryxx_encoder_sample_isr, encoder_p), std::chrono::microseconds(JERRYXX_ENCODER_SAMPLE_US));
+  return true;
+} /* jerryxx_encoder_init */
+
+/**
+ * Stop counting and give the pins and the timer back, keeping the last values.
+ */
+static void
+jerryxx_encoder_release(jerryxx_encoder_t *encoder_p) /**< encoder */
+{
+  if (!encoder_p->active)
+  {
+    return;
+  }
+
+  encoder_p->sampler.detach();
+  jerryxx_encoder_sample_isr(encoder_p);
+
+  if (encoder_p->tim_p != NULL)
+  {
+    /* Leave the timer as a plain counter for its next user */
+    encoder_p->tim_p->CR1 = 0;
+    encoder_p->tim_p->SMCR &= ~TIM_SMCR_SMS;
+    encoder_p->tim_p->CCMR1 = 0;
+    jerryxx_tim_set_user(encoder_p->tim_p, JERRYXX_TIM_FREE);
+  }
+
+  if (encoder_p->a_p != NULL)
+  {
+    delete encoder_p->a_p;
+    delete encoder_p->b_p;
+    encoder_p->a_p = NULL;
+    encoder_p->b_p = NULL;
+    jerryxx_exti_release(encoder_p->pin_a);
+    jerryxx_exti_release(encoder_p->pin_b);
+  }
+
+  encoder_p->active = false;
+} /* jerryxx_encoder_release */
+
+/**
+ * Current position of an encoder.
+ *
+ * @return signed number of counts since the creation or the last reset
+ */
+static int64_t
+jerryxx_encoder_position(jerryxx_encoder_t *encoder_p) /**< encoder */
+{
+  core_util_critical_section_enter();
+  int64_t position = encoder_p->position;
+
+  if (encoder_p->active)
+  {
+    position += (int64_t)jerryxx_encoder_delta(encoder_p, jerryxx_encoder_raw(encoder_p)) * encoder_p->direction;
+  }
+
+  core_util_critical_section_exit();
+  return position;
+} /* jerryxx_encoder_position */
+
+/**
+ * Set the position of an encoder back to zero.
+ */
+static void
+jerryxx_encoder_reset(jerryxx_encoder_t *encoder_p) /**< encoder */
+{
+  core_util_critical_section_enter();
+
+  if (encoder_p->active)
+  {
+    encoder_p->last_raw = jerryxx_encoder_raw(encoder_p);
+  }
+
+  encoder_p->position = 0;
+  core_util_critical_section_exit();
+} /* jerryxx_encoder_reset */
+
+/**
+ * Free the encoder of a collected Encoder object.
+ */
+static void
+jerryxx_encoder_free(void *native_p,                     /**< encoder */
+                     jerry_object_native_info_t *info_p) /**< type information */
+{
+  JERRYX_UNUSED(info_p);
+  jerryxx_encoder_t *encoder_p = (jerryxx_encoder_t *)native_p;
+
+  jerryxx_encoder_release(encoder_p);
+  delete encoder_p;
+} /* jerryxx_encoder_free */
+
+/**
+ * Type information of the Encoder objects.
+ */
+static const jerry_object_native_info_t jerryxx_encoder_info = {jerryxx_encoder_free, 0, 0};
+
+/**
+ * Free the registers of a collected DigitalOut or DigitalIn object. The pin keeps its mode.
+ */
+static void
+jerryxx_digital_free(void *native_p,                     /**< registers of the pin */
+                     jerry_object_native_info_t *info_p) /**< type information */
+{
+  JERRYX_UNUSED(info_p);
+  delete (jerryxx_gpio_t *)native_p;
+} /* jerryxx_digital_free */
+
+/**
+ * Type information of the DigitalOut objects.
+ */
+static const jerry_object_native_info_t jerryxx_digital_out_info = {jerryxx_digital_free, 0, 0};
+
+/**
+ * Type information of the DigitalIn objects.
+ */
+static const jerry_object_native_info_t jerryxx_digital_in_info = {jerryxx_digital_free, 0, 0};
+
+/**
+ * Free the group of a collected PinGroup object. The pins keep their mode.
+ */
+static void
+jerryxx_pin_group_free(void *native_p,                     /**< group */
+                       jerry_object_native_info_t *info_p) /**< type information */
+{
+  JERRYX_UNUSED(info_p);
+  delete (jerryxx_pin_group_t *)native_p;
+} /* jerryxx_pin_group_free */
+
+/**
+ * Type information of the PinGroup objects.
+ */
+static const jerry_object_native_info_t jerryxx_pin_group_info = {jerryxx_pin_group_free, 0, 0};
+
+/**
+ * Release all the pending timers, must be called before jerry_cleanup.
+ */
+void jerryxx_cleanup_scheduler(void)
+{
+  core_util_critical_section_enter();
+  jerryxx_gpio_timeout.detach();
+  jerryxx_gpio_action_count = 0;
+  core_util_critical_section_exit();
+
+  for (uint32_t idx = 0; idx < JERRYXX_TICKER_COUNT; idx++)
+  {
+    if (jerryxx_tickers[idx].active)
+    {
+      jerryxx_ticker_release(&jerryxx_tickers[idx]);
+    }
+  }
+
+  for (uint32_t pin = 0; pin < PINS_COUNT; pin++)
+  {
+    jerryxx_interrupt_detach(pin);
+  }
+  jerryxx_interrupt_tail = jerryxx_interrupt_head;
+
+  for (uint32_t idx = 0; idx < JERRYXX_PULSE_COUNT; idx++)
+  {
+    if (jerryxx_pulses[idx].active)
+    {
+      jerry_value_free(jerryxx_pulses[idx].promise);
+      jerryxx_pulse_release(&jerryxx_pulses[idx]);
+    }
+  }
+
+  for (uint32_t idx = 0; idx < JERRYXX_SEQUENCE_COUNT; idx++)
+  {
+    if (jerryxx_sequences[idx].active)
+    {
+      jerry_value_free(jerryxx_sequences[idx].promise);
+      jerryxx_sequence_release(&jerryxx_sequences[idx]);
+    }
+  }
+
+  /* The WaveformOut objects are freed by jerry_cleanup */
+  for (uint32_t idx = 0; idx < JERRYXX_WAVEFORM_COUNT; idx++)
+  {
+    jerryxx_waveform_stop(&jerryxx_waveforms[idx]);
+  }
+
+  if (!jerryxx_timer_wheel_ready)
+  {
+    return;
+  }
+
+  for (uint32_t idx = 0; idx < JERRYXX_TIMER_POOL_SIZE; idx++)
+  {
+    if (jerryxx_timer_pool[idx].state != JERRYXX_TIMER_FREE)
+    {
+      jerry_value_free(jerryxx_timer_pool[idx].callback_fn);
+    }
+  }
+
+  jerryxx_timer_wheel_ready = false;
+} /* jerryxx_cleanup_scheduler */
+
+/**
+ * Register a JavaScript property in the global object.
+ *
+ * @return true - if the operation was successful,
+ *         false - otherwise.
+ */
+bool jerryxx_register_global_property(const char *name_p,  /**< name of the property */
+                                      jerry_value_t value, /**< value of the property */
+                                      bool free_value)     /**< take ownership of the value */
+{
+  jerry_value_t global_obj_val = jerry_current_realm();
+  jerry_value_t property_name_val = jerry_string_sz(name_p);
+
+  jerry_value_t result_val = jerry_object_set(global_obj_val, property_name_val, value);
+  bool result = jerry_value_is_true(result_val);
+
+  jerry_value_free(result_val);
+  jerry_value_free(property_name_val);
+  jerry_value_free(global_obj_val);
+
+  if (free_value)
+  {
+    jerry_value_free(value);
+  }
+
+  return result;
+} /* jerryxx_register_global_property */
+
+/**
+ * Register a JavaScript object holding the given properties in the global object.
+ *
+ * @return true - if the operation was successful,
+ *         false - otherwise.
+ */
+static bool
+jerryxx_register_global_object(const char *name_p,                   /**< name of the object */
+                               const jerryx_property_entry entries[]) /**< properties, ended by a NULL name */
+{
+  jerry_value_t object = jerry_object();
+  jerryx_register_result reg = jerryx_set_properties(object, entries);
+
+  if (jerry_value_is_exception(reg.result))
+  {
+    jerryx_release_property_entry(entries, reg);
+    jerry_value_free(reg.result);
+    jerry_value_free(object);
+    return false;
+  }
+
+  jerry_value_free(reg.result);
+
+  return jerryxx_register_global_property(name_p, object, true);
+} /* jerryxx_register_global_object */
+
+/**
+ * Set a numeric property of a JavaScript object.
+ */
+static void
+jerryxx_object_set_number(jerry_value_t object, /**< target object */
+                          const char *name_p,   /**< name of the property */
+                          double number)        /**< value of the property */
+{
+  jerry_value_t value = jerry_number(number);
+  jerry_value_free(jerry_object_set_sz(object, name_p, value));
+  jerry_value_free(value);
+} /* jerryxx_object_set_number */
+
+/**
+ * Read-only accessor property of the prototype of a native class.
+ */
+typedef struct
+{
+  const char *name_p;                /**< name of the property */
+  jerry_external_handler_t getter_p; /**< function returning its value */
+} jerryxx_getter_entry;
+
+/**
+ * Register a JavaScript constructor in the global object, with the given
+ * methods and getters on its prototype.
+ *
+ * @return true - if the operation was successful,
+ *         false - otherwise.
+ */
+static bool
+jerryxx_register_global_class(const char *name_p,                   /**< name of the constructor */
+                              jerry_external_handler_t constructor,  /**< constructor, called with new */
+                              const jerryx_property_entry methods[], /**< methods, ended by a NULL name */
+                              const jerryxx_getter_entry getters[])  /**< getters, ended by a NULL name, or NULL for none */
+{
+  jerry_value_t prototype = jerry_object();
+  jerryx_register_result reg = jerryx_set_properties(prototype, methods);
+
+  if (jerry_value_is_exception(reg.result))
+  {
+    jerryx_release_property_entry(methods, reg);
+    jerry_value_free(reg.result);
+    jerry_value_free(prototype);
+    return false;
+  }
+
+  jerry_value_free(reg.result);
+
+  bool result = true;
+
+  for (uint32_t idx = 0; result && getters != NULL && getters[idx].name_p != NULL; idx++)
+  {
+    jerry_property_descriptor_t prop_desc = jerry_property_descriptor();
+    prop_desc.flags |= JERRY_PROP_IS_GET_DEFINED | JERRY_PROP_IS_CONFIGURABLE_DEFINED | JERRY_PROP_IS_CONFIGURABLE;
+    prop_desc.getter = jerry_function_external(getters[idx].getter_p);
+
+    jerry_value_t property_name = jerry_string_sz(getters[idx].name_p);
+    jerry_value_t rv = jerry_object_define_own_prop(prototype, property_name, &prop_desc);
+    result = jerry_value_is_true(rv);
+
+    jerry_value_free(rv);
+    jerry_value_free(property_name);
+    jerry_property_descriptor_free(&prop_desc);
+  }
+
+  jerry_value_t function = jerry_function_external(constructor);
+  jerry_value_free(jerry_object_set_sz(function, "prototype", prototype));
+  jerry_value_free(prototype);
+
+  if (!result)
+  {
+    jerry_value_free(function);
+    return false;
+  }
+
+  return jerryxx_register_global_property(name_p, function, true);
+} /* jerryxx_register_global_class */
+
+/**
+ * Register Extra API into JavaScript global object.
+ *
+ * @return true - if the operation was successful,
+ *         false - otherwise.
+ */
+bool jerryxx_register_extra_api(void)
+{
+  bool ret = false;
+
+  /* Register the print function in the global object */
+  JERRYXX_BOOL_CHK(jerryx_register_global("print", jerryx_handler_print));
+
+  /* Register the setTimeout function in the global object */
+  JERRYXX_BOOL_CHK(jerryx_register_global("setTimeout", js_set_timeout));
+
+  /* Register the clearTimeout function in the global object */
+  JERRYXX_BOOL_CHK(jerryx_register_global("clearTimeout", js_clear_timeout));
+
+  /* Register the setInterval function in the global object */
+  JERRYXX_BOOL_CHK(jerryx_register_global("setInterval", js_set_interval));
+
+  /* Register the clearInterval function in the global object */
+  JERRYXX_BOOL_CHK(jerryx_register_global("clearInterval", js_clear_interval));
+
+  /* Register the setCallbackBudget function and its modes in the global object */
+  JERRYXX_BOOL_CHK(jerryx_register_global("setCallbackBudget", js_set_callback_budget));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("BUDGET_THROW", jerry_number(JERRYXX_BUDGET_THROW), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("BUDGET_ABORT", jerry_number(JERRYXX_BUDGET_ABORT), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("BUDGET_REPORT", jerry_number(JERRYXX_BUDGET_REPORT), true));
+
+  /* Register the delayAsync function in the global object */
+  JERRYXX_BOOL_CHK(jerryx_register_global("delayAsync", js_delay_async));
+
+  /* Register the requestIdleCallback function in the global object */
+  JERRYXX_BOOL_CHK(jerryx_register_global("requestIdleCallback", js_request_idle_callback));
+  JERRYXX_BOOL_CHK(jerryx_register_global("cancelIdleCallback", js_cancel_idle_callback));
+
+  /* Register the queueMicrotask function in the global object */
+  JERRYXX_BOOL_CHK(jerryx_register_global("queueMicrotask", js_queue_microtask));
+
+  /* Register the getIntervalStats function in the global object */
+  JERRYXX_BOOL_CHK(jerryx_register_global("getIntervalStats", js_get_interval_stats));
+
+  /* Register the setInterval policies in the global object */
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("INTERVAL_FIXED_DELAY", jerry_number(JERRYXX_INTERVAL_FIXED_DELAY), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("INTERVAL_SKIP", jerry_number(JERRYXX_INTERVAL_SKIP), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("INTERVAL_CATCH_UP", jerry_number(JERRYXX_INTERVAL_CATCH_UP), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("INTERVAL_COALESCE", jerry_number(JERRYXX_INTERVAL_COALESCE), true));
+
+  /* Register the setTicker function and its actions in the global object */
+  JERRYXX_BOOL_CHK(jerryx_register_global("setTicker", js_set_ticker));
+  JERRYXX_BOOL_CHK(jerryx_register_global("clearTicker", js_clear_ticker));
+  JERRYXX_BOOL_CHK(jerryx_register_global("getTickerStats", js_get_ticker_stats));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("TICKER_ANALOG", jerry_number(JERRYXX_TICKER_ANALOG), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("TICKER_DIGITAL", jerry_number(JERRYXX_TICKER_DIGITAL), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("TICKER_COUNTER", jerry_number(JERRYXX_TICKER_COUNTER), true));
+
+  /* Register the runtime object in the global object */
+  {
+    const jerryx_property_entry runtime_entries[] =
+        {
+            {"stats", jerry_function_external(js_runtime_stats)},
+            {"resetStats", jerry_function_external(js_runtime_reset_stats)},
+            {NULL, 0},
+        };
+
+    JERRYXX_BOOL_CHK(jerryxx_register_global_object("runtime", runtime_entries));
+  }
+
+cleanup:
+  return ret;
+} /* jerryxx_register_extra_api */
+
+/**
+ * Javascript: setTimeout
+ */
+JERRYXX_DECLARE_FUNCTION(set_timeout)
+{
+  JERRYX_UNUSED(call_info_p);
+  jerry_value_t callback_fn = 0;
+  uint32_t delay_time = 0;
+  uint32_t slack = 0;
+
+  const char *options_names[] = {"slack"};
+  const jerryx_arg_t options_mapping[] =
+      {
+          jerryx_arg_uint32(&slack, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_OPTIONAL),
+      };
+  const jerryx_arg_object_props_t options =
+      {
+          (const jerry_char_t **)options_names,
+          JERRYXX_ARRAY_SIZE(options_names),
+          options_mapping,
+          JERRYXX_ARRAY_SIZE(options_mapping),
+      };
+
+  const jerryx_arg_t mapping[] =
+      {
+          jerryx_arg_function(&callback_fn, JERRYX_ARG_REQUIRED),
+          jerryx_arg_uint32(&delay_time, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_OPTIONAL),
+          jerryx_arg_object_properties(&options, JERRYX_ARG_OPTIONAL),
+      };
+
+  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
+  if (jerry_value_is_exception(rv))
+  {
+    return rv;
+  }
+
+  jerryxx_timer_t *timer_p = jerryxx_timer_create(callback_fn, delay_time, false, JERRYXX_INTERVAL_FIXED_DELAY, slack);
+  if (timer_p == NULL)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "No scheduler slot free found.");
+  }
+
+  return jerry_number(jerryxx_timer_id(timer_p));
+} /* js_set_timeout */
+
+/**
+ * Javascript: clearTimeout
+ */
+JERRYXX_DECLARE_FUNCTION(clear_timeout)
+{
+  JERRYX_UNUSED(call_info_p);
+  uint32_t timeout_id = 0;
+
+  const jerryx_arg_t mapping[] =
+      {
+          jerryx_arg_uint32(&timeout_id, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+      };
+
+  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
+  if (jerry_value_is_exception(rv))
+  {
+    return rv;
+  }
+
+  jerryxx_timer_cancel(timeout_id);
+
+  return jerry_undefined();
+} /* js_clear_timeout */
+
+/**
+ * Javascript: setInterval
+ */
+JERRYXX_DECLARE_FUNCTION(set_interval)
+{
+  JERRYX_UNUSED(call_info_p);
+  jerry_value_t callback_fn = 0;
+  uint32_t delay_time = 0;
+  uint32_t policy = JERRYXX_INTERVAL_FIXED_DELAY;
+  uint32_t slack = 0;
+
+  const char *options_names[] = {"policy", "slack"};
+  const jerryx_arg_t options_mapping[] =
+      {
+          jerryx_arg_uint32(&policy, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_OPTIONAL),
+          jerryx_arg_uint32(&slack, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_OPTIONAL),
+      };
+  const jerryx_arg_object_props_t options =
+      {
+          (const jerry_char_t **)options_names,
+          JERRYXX_ARRAY_SIZE(options_names),
+          options_mapping,
+          JERRYXX_ARRAY_SIZE(options_mapping),
+      };
+
+  const jerryx_arg_t mapping[] =
+      {
+          jerryx_arg_function(&callback_fn, JERRYX_ARG_REQUIRED),
+          jerryx_arg_uint32(&delay_time, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_OPTIONAL),
+          jerryx_arg_object_properties(&options, JERRYX_ARG_OPTIONAL),
+      };
+
+  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
+  if (jerry_value_is_exception(rv))
+  {
+    return rv;
+  }
+
+  if (policy > JERRYXX_INTERVAL_COALESCE)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong option 'policy' must be INTERVAL_FIXED_DELAY, INTERVAL_SKIP, INTERVAL_CATCH_UP or INTERVAL_COALESCE.");
+  }
+
+  jerryxx_timer_t *timer_p = jerryxx_timer_create(callback_fn, delay_time, true, (uint8_t)policy, slack);
+  if (timer_p == NULL)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "No scheduler slot free found.");
+  }
+
+  return jerry_number(jerryxx_timer_id(timer_p));
+} /* js_set_interval */
+
+/**
+ * Javascript: clearInterval
+ */
+JERRYXX_DECLARE_FUNCTION(clear_interval)
+{
+  JERRYX_UNUSED(call_info_p);
+  uint32_t interval_id = 0;
+
+  const jerryx_arg_t mapping[] =
+      {
+          jerryx_arg_uint32(&interval_id, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+      };
+
+  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
+  if (jerry_value_is_exception(rv))
+  {
+    return rv;
+  }
+
+  jerryxx_timer_cancel(interval_id);
+
+  return jerry_undefined();
+} /* js_clear_interval */
+
+/**
+ * Javascript: requestIdleCallback
+ */
+JERRYXX_DECLARE_FUNCTION(request_idle_callback)
+{
+  JERRYX_UNUSED(call_info_p);
+  jerry_value_t callback_fn = 0;
+
+  const jerryx_arg_t mapping[] =
+      {
+          jerryx_arg_function(&callback_fn, JERRYX_ARG_REQUIRED),
+      };
+
+  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
+  if (jerry_value_is_exception(rv))
+  {
+    return rv;
+  }
+
+  jerryxx_timer_t *timer_p = jerryxx_idle_create(callback_fn);
+  if (timer_p == NULL)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "No scheduler slot free found.");
+  }
+
+  return jerry_number(jerryxx_timer_id(timer_p));
+} /* js_request_idle_callback */
+
+/**
+ * Javascript: cancelIdleCallback
+ */
+JERRYXX_DECLARE_FUNCTION(cancel_idle_callback)
+{
+  JERRYX_UNUSED(call_info_p);
+  uint32_t idle_id = 0;
+
+  const jerryx_arg_t mapping[] =
+      {
+          jerryx_arg_uint32(&idle_id, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+      };
+
+  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
+  if (jerry_value_is_exception(rv))
+  {
+    return rv;
+  }
+
+  jerryxx_timer_cancel(idle_id);
+
+  return jerry_undefined();
+} /* js_cancel_idle_callback */
+
+/**
+ * Reaction of a microtask: call the callback bound to the reaction and
+ * report its exception like the other callbacks of the event loop, instead
+ * of turning it into the rejection of a Promise nobody observes.
+ */
+static jerry_value_t
+jerryxx_microtask_run(const jerry_call_info_t *call_info_p, /**< call information */
+                      const jerry_value_t args_p[],         /**< function arguments */
+                      const jerry_length_t args_cnt)        /**< number of function arguments */
+{
+  JERRYX_UNUSED(args_p);
+  JERRYX_UNUSED(args_cnt);
+
+  jerry_value_t name_val = jerry_string_sz("callback");
+  jerry_value_t callback_fn = jerry_object_get_internal(call_info_p->function, name_val);
+  jerry_value_free(name_val);
+
+  jerry_value_t global_obj_val = jerry_current_realm();
+  jerry_value_t result_val = jerry_call(callback_fn, global_obj_val, NULL, 0);
+  jerry_value_free(global_obj_val);
+  jerry_value_free(callback_fn);
+
+  if (jerry_value_is_exception(result_val))
+  {
+    jerryx_print_unhandled_exception(result_val);
+  }
+  else
+  {
+    jerry_value_free(result_val);
+  }
+
+  return jerry_undefined();
+} /* jerryxx_microtask_run */
+
+/**
+ * Javascript: queueMicrotask
+ */
+JERRYXX_DECLARE_FUNCTION(queue_microtask)
+{
+  JERRYX_UNUSED(call_info_p);
+  jerry_value_t callback_fn = 0;
+
+  const jerryx_arg_t mapping[] =
+      {
+          jerryx_arg_function(&callback_fn, JERRYX_ARG_REQUIRED),
+      };
+
+  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
+  if (jerry_value_is_exception(rv))
+  {
+    return rv;
+  }
+
+  /* The reaction calls the callback and reports its exception */
+  jerry_value_t reaction_fn = jerry_function_external(jerryxx_microtask_run);
+  jerry_value_t name_val = jerry_string_sz("callback");
+  jerry_object_set_internal(reaction_fn, name_val, callback_fn);
+  jerry_value_free(name_val);
+
+  /* Share the job queue of the Promises: Promise.resolve().then(reaction) */
+  jerry_value_t promise = jerry_promise();
+  jerry_value_t undefined_val = jerry_undefined();
+  jerry_value_free(jerry_promise_resolve(promise, undefined_val));
+  jerry_value_free(undefined_val);
+
+  jerry_value_t then_fn = jerry_object_get_sz(promise, "then");
+  jerry_value_t result_val = jerry_call(then_fn, promise, &reaction_fn, 1);
+  jerry_value_free(then_fn);
+  jerry_value_free(promise);
+  jerry_value_free(reaction_fn);
+
+  if (jerry_value_is_exception(result_val))
+  {
+    return result_val;
+  }
+
+  jerry_value_free(result_val);
+
+  return jerry_undefined();
+} /* js_queue_microtask */
+
+/**
+ * Javascript: setCallbackBudget
+ */
+JERRYXX_DECLARE_FUNCTION(set_callback_budget)
+{
+  JERRYX_UNUSED(call_info_p);
+  uint32_t budget_ms = 0;
+  uint32_t mode = JERRYXX_BUDGET_THROW;
+  uint32_t interval = JERRYXX_HALT_CHECK_INTERVAL;
+
+  const jerryx_arg_t mapping[] =
+      {
+          jerryx_arg_uint32(&budget_ms, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+          jerryx_arg_uint32(&mode, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_OPTIONAL),
+          jerryx_arg_uint32(&interval, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_OPTIONAL),
+      };
+
+  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
+  if (jerry_value_is_exception(rv))
+  {
+    return rv;
+  }
+
+  if (mode > JERRYXX_BUDGET_REPORT)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'mode' must be BUDGET_THROW, BUDGET_ABORT or BUDGET_REPORT.");
+  }
+
+  if (!jerryxx_set_callback_budget(budget_ms, (jerryxx_budget_mode_t)mode, interval))
+  {
+    return jerry_throw_sz(JERRY_ERROR_COMMON, "Callback budget requires JERRY_VM_HALT.");
+  }
+
+  return jerry_undefined();
+} /* js_set_callback_budget */
+
+/**
+ * Javascript: delayAsync
+ */
+JERRYXX_DECLARE_FUNCTION(delay_async)
+{
+  JERRYX_UNUSED(call_info_p);
+  uint32_t delay_time = 0;
+
+  const jerryx_arg_t mapping[] =
+      {
+          jerryx_arg_uint32(&delay_time, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+      };
+
+  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
+  if (jerry_value_is_exception(rv))
+  {
+    return rv;
+  }
+
+  jerry_value_t promise = jerry_promise();
+
+  jerryxx_timer_t *timer_p = jerryxx_timer_create(promise, delay_time, false, JERRYXX_INTERVAL_FIXED_DELAY, 0);
+  if (timer_p == NULL)
+  {
+    jerry_value_free(promise);
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "No scheduler slot free found.");
+  }
+
+  timer_p->kind = JERRYXX_TIMER_PROMISE;
+
+  return promise;
+} /* js_delay_async */
+
+/**
+ * Javascript: getIntervalStats
+ */
+JERRYXX_DECLARE_FUNCTION(get_interval_stats)
+{
+  JERRYX_UNUSED(call_info_p);
+  uint32_t interval_id = 0;
+
+  const jerryx_arg_t mapping[] =
+      {
+          jerryx_arg_uint32(&interval_id, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+      };
+
+  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
+  if (jerry_value_is_exception(rv))
+  {
+    return rv;
+  }
+
+  jerryxx_timer_t *timer_p = jerryxx_timer_from_id(interval_id);
+  if (timer_p == NULL || timer_p->interval == 0)
+  {
+    return jerry_undefined();
+  }
+
+  jerry_value_t stats = jerry_object();
+  jerryxx_object_set_number(stats, "fired", timer_p->fired);
+  jerryxx_object_set_number(stats, "overruns", timer_p->overruns);
+  jerryxx_object_set_number(stats, "missed", timer_p->missed);
+  jerryxx_object_set_number(stats, "maxLateness", timer_p->max_lateness);
+  jerryxx_object_set_number(stats, "coalesced", timer_p->coalesced);
+
+  return stats;
+} /* js_get_interval_stats */
+
+/**
+ * Javascript: setTicker
+ */
+JERRYXX_DECLARE_FUNCTION(set_ticker)
+{
+  JERRYX_UNUSED(call_info_p);
+  jerry_value_t callback_fn = 0;
+  uint32_t period_us = 0;
+  uint32_t action = JERRYXX_TICKER_ANALOG;
+  uint32_t pin = 0;
+  uint32_t batch = 0;
+  uint32_t decimate = 1;
+
+  const char *options_names[] = {"action", "pin", "batch", "decimate"};
+  const jerryx_arg_t options_mapping[] =
+      {
+          jerryx_arg_uint32(&action, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+          jerryx_arg_uint32(&pin, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+          jerryx_arg_uint32(&batch, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+          jerryx_arg_uint32(&decimate, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_OPTIONAL),
+      };
+  const jerryx_arg_object_props_t options =
+      {
+          (const jerry_char_t **)options_names,
+          JERRYXX_ARRAY_SIZE(options_names),
+          options_mapping,
+          JERRYXX_ARRAY_SIZE(options_mapping),
+      };
+
+  const jerryx_arg_t mapping[] =
+      {
+          jerryx_arg_function(&callback_fn, JERRYX_ARG_REQUIRED),
+          jerryx_arg_uint32(&period_us, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+          jerryx_arg_object_properties(&options, JERRYX_ARG_REQUIRED),
+      };
+
+  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
+  if (jerry_value_is_exception(rv))
+  {
+    return rv;
+  }
+
+  if (period_us < JERRYXX_TICKER_MIN_PERIOD_US)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'periodUs' is too short.");
+  }
+
+  if (action > JERRYXX_TICKER_COUNTER)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong option 'action' must be TICKER_ANALOG, TICKER_DIGITAL or TICKER_COUNTER.");
+  }
+
+  jerryxx_gpio_t gpio;
+
+  if (!jerryxx_gpio_from_pin(pin, &gpio))
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong option 'pin' must be a pin.");
+  }
+
+  /* analogin_init stops the board on a pin without ADC */
+  if (action == JERRYXX_TICKER_ANALOG && pinmap_find_peripheral(digitalPinToPinName((pin_size_t)pin), PinMap_ADC) == (uint32_t)NC)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong option 'pin' must be an analog pin.");
+  }
+
+  if (action == JERRYXX_TICKER_COUNTER && !jerryxx_exti_is_free(pin))
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong option 'pin' shares its interrupt line with a pin in use.");
+  }
+
+  if (batch == 0 || batch > JERRYXX_TICKER_BATCH_MAX)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong option 'batch' must be between 1 and JERRYXX_TICKER_BATCH_MAX.");
+  }
+
+  if (decimate == 0)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong option 'decimate' must be at least 1.");
+  }
+
+  jerryxx_ticker_t *ticker_p = jerryxx_ticker_create(callback_fn, period_us, (uint8_t)action, pin, batch, decimate);
+  if (ticker_p == NULL)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "No ticker slot free found.");
+  }
+
+  return jerry_number(jerryxx_ticker_id(ticker_p));
+} /* js_set_ticker */
+
+/**
+ * Javascript: clearTicker
+ */
+JERRYXX_DECLARE_FUNCTION(clear_ticker)
+{
+  JERRYX_UNUSED(call_info_p);
+  uint32_t ticker_id = 0;
+
+  const jerryx_arg_t mapping[] =
+      {
+          jerryx_arg_uint32(&ticker_id, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+      };
+
+  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
+  if (jerry_value_is_exception(rv))
+  {
+    return rv;
+  }
+
+  jerryxx_ticker_t *ticker_p = jerryxx_ticker_from_id(ticker_id);
+  if (ticker_p != NULL)
+  {
+    jerryxx_ticker_release(ticker_p);
+  }
+
+  return jerry_undefined();
+} /* js_clear_ticker */
+
+/**
+ * Javascript: getTickerStats
+ */
+JERRYXX_DECLARE_FUNCTION(get_ticker_stats)
+{
+  JERRYX_UNUSED(call_info_p);
+  uint32_t ticker_id = 0;
+
+  const jerryx_arg_t mapping[] =
+      {
+          jerryx_arg_uint32(&ticker_id, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+      };
+
+  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
+  if (jerry_value_is_exception(rv))
+  {
+    return rv;
+  }
+
+  jerryxx_ticker_t *ticker_p = jerryxx_ticker_from_id(ticker_id);
+  if (ticker_p == NULL)
+  {
+    return jerry_undefined();
+  }
+
+  jerry_value_t stats = jerry_object();
+  jerryxx_object_set_number(stats, "ticks", ticker_p->ticks);
+  jerryxx_object_set_number(stats, "batches", ticker_p->batches);
+  jerryxx_object_set_number(stats, "overruns", ticker_p->overruns);
+
+  return stats;
+} /* js_get_ticker_stats */
+
+/**
+ * Javascript: runtime.stats
+ */
+JERRYXX_DECLARE_FUNCTION(runtime_stats)
+{
+  JERRYX_UNUSED(call_info_p);
+  JERRYX_UNUSED(args_p);
+  JERRYXX_ON_ARGS_COUNT_THROW_ERROR_SYNTAX(args_cnt != 0, "Wrong arguments count");
+
+  jerryxx_loop_stats_t loop_stats;
+  jerryxx_idle_stats_t idle_stats;
+  jerryxx_get_loop_stats(&loop_stats);
+  jerryxx_get_idle_stats(&idle_stats);
+
+  jerry_value_t stats = jerry_object();
+  jerryxx_object_set_number(stats, "lag", loop_stats.last_lag);
+  jerryxx_object_set_number(stats, "maxLag", loop_stats.max_lag);
+  jerryxx_object_set_number(stats, "pendingTimers", loop_stats.pending_timers);
+  jerryxx_object_set_number(stats, "pendingCallbacks", loop_stats.pending_callbacks);
+  jerryxx_object_set_number(stats, "maxPendingCallbacks", loop_stats.max_pending_callbacks);
+  jerryxx_object_set_number(stats, "callbacks", loop_stats.callbacks);
+  jerryxx_object_set_number(stats, "callbackTime", (double)loop_stats.callback_time);
+  jerryxx_object_set_number(stats, "maxCallbackTime", loop_stats.max_callback_time);
+  jerryxx_object_set_number(stats, "coalesced", loop_stats.coalesced);
+  jerryxx_object_set_number(stats, "budgetOverruns", jerryxx_budget_overruns);
+  jerryxx_object_set_number(stats, "sleeps", idle_stats.sleeps);
+  jerryxx_object_set_number(stats, "eventWakeups", idle_stats.event_wakeups);
+  jerryxx_object_set_number(stats, "idleTime", (double)idle_stats.idle_time);
+  jerryxx_object_set_number(stats, "maxWakeLatency", idle_stats.max_wake_latency);
+
+  /* Counters of the lanes, from the highest priority */
+  const char *lane_names[JERRYXX_LANE_COUNT] = {"interrupt", "io", "timer", "idle"};
+  jerry_value_t lanes = jerry_object();
+
+  for (uint32_t lane = 0; lane < JERRYXX_LANE_COUNT; lane++)
+  {
+    jerry_value_t lane_stats = jerry_object();
+    jerryxx_object_set_number(lane_stats, "pending", loop_stats.lanes[lane].pending);
+    jerryxx_object_set_number(lane_stats, "dispatched", loop_stats.lanes[lane].dispatched);
+    jerryxx_object_set_number(lane_stats, "promoted", loop_stats.lanes[lane].promoted);
+    jerry_value_free(jerry_object_set_sz(lanes, lane_names[lane], lane_stats));
+    jerry_value_free(lane_stats);
+  }
+
+  jerry_value_free(jerry_object_set_sz(stats, "lanes", lanes));
+  jerry_value_free(lanes);
+
+  /* Histogram of the lateness: counts[i] timers fired at most bounds[i] microseconds late */
+  jerry_value_t bounds = jerry_array(JERRYXX_LATENESS_BUCKETS);
+  jerry_value_t counts = jerry_array(JERRYXX_LATENESS_BUCKETS);
+
+  for (uint32_t idx = 0; idx < JERRYXX_LATENESS_BUCKETS; idx++)
+  {
+    jerry_value_t bound = idx < JERRYXX_LATENESS_BUCKETS - 1 ? jerry_number(jerryxx_lateness_bounds[idx]) : jerry_infinity(false);
+    jerry_value_t count = jerry_number(loop_stats.lateness[idx]);
+    jerry_value_free(jerry_object_set_index(bounds, idx, bound));
+    jerry_value_free(jerry_object_set_index(counts, idx, count));
+    jerry_value_free(bound);
+    jerry_value_free(count);
+  }
+
+  jerry_value_t lateness = jerry_object();
+  jerry_value_free(jerry_object_set_sz(lateness, "bounds", bounds));
+  jerry_value_free(jerry_object_set_sz(lateness, "counts", counts));
+  jerry_value_free(jerry_object_set_sz(stats, "lateness", lateness));
+  jerry_value_free(bounds);
+  jerry_value_free(counts);
+  jerry_value_free(lateness);
+
+  return stats;
+} /* js_runtime_stats */
+
+/**
+ * Javascript: runtime.resetStats
+ */
+JERRYXX_DECLARE_FUNCTION(runtime_reset_stats)
+{
+  JERRYX_UNUSED(call_info_p);
+  JERRYX_UNUSED(args_p);
+  JERRYXX_ON_ARGS_COUNT_THROW_ERROR_SYNTAX(args_cnt != 0, "Wrong arguments count");
+
+  jerryxx_reset_loop_stats();
+
+  return jerry_undefined();
+} /* js_runtime_reset_stats */
+
+/*******************************************************************************
+ *                                  Arduino API                                *
+ ******************************************************************************/
+
+/**
+ * Register Arduino API into JavaScript global object.
+ *
+ * @return true - if the operation was successful,
+ *         false - otherwise.
+ */
+bool jerryxx_register_arduino_api(void)
+{
+  bool ret = false;
+
+  /* Register Constants in the global object */
+
+  /* Bit Order */
   JERRYXX_BOOL_CHK(jerryxx_register_global_property("LSBFIRST", jerry_number(LSBFIRST), true));
   JERRYXX_BOOL_CHK(jerryxx_register_global_property("MSBFIRST", jerry_number(MSBFIRST), true));
 
-  /* PINs Status */
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("HIGH", jerry_number(HIGH), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("LOW", jerry_number(LOW), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("CHANGE", jerry_number(CHANGE), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("RISING", jerry_number(RISING), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("FALLING", jerry_number(FALLING), true));
+  /* PINs Status */
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("HIGH", jerry_number(HIGH), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("LOW", jerry_number(LOW), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("CHANGE", jerry_number(CHANGE), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("RISING", jerry_number(RISING), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("FALLING", jerry_number(FALLING), true));
+
+  /* PINs Mode */
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("INPUT", jerry_number(INPUT), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("OUTPUT", jerry_number(OUTPUT), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("INPUT_PULLUP", jerry_number(INPUT_PULLUP), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("INPUT_PULLDOWN", jerry_number(INPUT_PULLDOWN), true));
+#if defined(OUTPUT_OPENDRAIN)
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("OUTPUT_OPENDRAIN", jerry_number(OUTPUT_OPENDRAIN), true));
+#endif
+
+  /* LEDs */
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("PIN_LED", jerry_number(PIN_LED), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("LED_BUILTIN", jerry_number(LED_BUILTIN), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("LEDR", jerry_number(LEDR), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("LEDG", jerry_number(LEDG), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("LEDB", jerry_number(LEDB), true));
+
+  /* Analog pins */
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("A0", jerry_number(A0), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("A1", jerry_number(A1), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("A2", jerry_number(A2), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("A3", jerry_number(A3), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("A4", jerry_number(A4), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("A5", jerry_number(A5), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("A6", jerry_number(A6), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("A7", jerry_number(A7), true));
+
+  /* Ports */
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("PORTA", jerry_number(PortA), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("PORTB", jerry_number(PortB), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("PORTC", jerry_number(PortC), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("PORTD", jerry_number(PortD), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("PORTE", jerry_number(PortE), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("PORTF", jerry_number(PortF), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("PORTG", jerry_number(PortG), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("PORTH", jerry_number(PortH), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("PORTI", jerry_number(PortI), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("PORTJ", jerry_number(PortJ), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("PORTK", jerry_number(PortK), true));
+
+  /* Digital pins */
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D0", jerry_number(D0), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D1", jerry_number(D1), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D2", jerry_number(D2), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D3", jerry_number(D3), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D4", jerry_number(D4), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D5", jerry_number(D5), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D6", jerry_number(D6), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D7", jerry_number(D7), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D8", jerry_number(D8), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D9", jerry_number(D9), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D10", jerry_number(D10), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D11", jerry_number(D11), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D12", jerry_number(D12), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D13", jerry_number(D13), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D14", jerry_number(D14), true));
+/* Pin D15, D16, D17 and D18 cannot be used as digital pin.*/
+/*
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D15", jerry_number (D15), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D16", jerry_number (D16), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D17", jerry_number (D17), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D18", jerry_number (D18), true));
+ */
+#if defined(CORE_CM7)
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D19", jerry_number(D19), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D20", jerry_number(D20), true));
+  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D21", jerry_number(D21), true));
+#endif
+
+  /* Register Functions in the global object */
+
+  /* Digital I/O */
+  JERRYXX_BOOL_CHK(jerryx_register_global("pinMode", js_pin_mode));
+  JERRYXX_BOOL_CHK(jerryx_register_global("digitalWrite", js_digital_write));
+  JERRYXX_BOOL_CHK(jerryx_register_global("digitalRead", js_digital_read));
+  JERRYXX_BOOL_CHK(jerryx_register_global("digitalWriteAt", js_digital_write_at));
+  JERRYXX_BOOL_CHK(jerryx_register_global("digitalWriteAtBatch", js_digital_write_at_batch));
+  JERRYXX_BOOL_CHK(jerryx_register_global("getDigitalWriteAtStats", js_get_digital_write_at_stats));
+
+  /* DigitalOut */
+  {
+    const jerryx_property_entry digital_out_methods[] =
+        {
+            {"write", jerry_function_external(js_digital_out_write)},
+            {"read", jerry_function_external(js_digital_out_read)},
+            {"toggle", jerry_function_external(js_digital_out_toggle)},
+            {NULL, 0},
+        };
+
+    JERRYXX_BOOL_CHK(jerryxx_register_global_class("DigitalOut", js_digital_out, digital_out_methods, NULL));
+  }
+
+  /* DigitalIn */
+  {
+    const jerryx_property_entry digital_in_methods[] =
+        {
+            {"read", jerry_function_external(js_digital_in_read)},
+            {NULL, 0},
+        };
+
+    JERRYXX_BOOL_CHK(jerryxx_register_global_class("DigitalIn", js_digital_in, digital_in_methods, NULL));
+  }
+
+  /* Ports */
+  JERRYXX_BOOL_CHK(jerryx_register_global("digitalPinToPort", js_digital_pin_to_port));
+  JERRYXX_BOOL_CHK(jerryx_register_global("digitalPinToBitMask", js_digital_pin_to_bit_mask));
+  JERRYXX_BOOL_CHK(jerryx_register_global("portWrite", js_port_write));
+  JERRYXX_BOOL_CHK(jerryx_register_global("portRead", js_port_read));
+
+  /* PinGroup */
+  {
+    const jerryx_property_entry pin_group_methods[] =
+        {
+            {"write", jerry_function_external(js_pin_group_write)},
+            {"read", jerry_function_external(js_pin_group_read)},
+            {NULL, 0},
+        };
+
+    JERRYXX_BOOL_CHK(jerryxx_register_global_class("PinGroup", js_pin_group, pin_group_methods, NULL));
+  }
+
+  /* WaveformOut */
+  {
+    const jerryx_property_entry waveform_out_methods[] =
+        {
+            {"play", jerry_function_external(js_waveform_out_play)},
+            {"loop", jerry_function_external(js_waveform_out_loop)},
+            {"stop", jerry_function_external(js_waveform_out_stop)},
+            {"close", jerry_function_external(js_waveform_out_close)},
+            {NULL, 0},
+        };
+    const jerryxx_getter_entry waveform_out_getters[] =
+        {
+            {"playing", js_waveform_out_playing},
+            {"passes", js_waveform_out_passes},
+            {NULL, NULL},
+        };
+
+    JERRYXX_BOOL_CHK(jerryxx_register_global_class("WaveformOut", js_waveform_out, waveform_out_methods, waveform_out_getters));
+  }
+
+  /* Time */
+  JERRYXX_BOOL_CHK(jerryx_register_global("delay", js_delay));
+  JERRYXX_BOOL_CHK(jerryx_register_global("delayMicroseconds", js_delay_microseconds));
+  JERRYXX_BOOL_CHK(jerryx_register_global("micros", js_micros));
+  JERRYXX_BOOL_CHK(jerryx_register_global("millis", js_millis));
+  /* Math */
+  JERRYXX_BOOL_CHK(jerryx_register_global("constrain", js_constrain));
+  JERRYXX_BOOL_CHK(jerryx_register_global("map", js_map));
+  JERRYXX_BOOL_CHK(jerryx_register_global("sq", js_sq));
+  /* 'abs', 'max', 'min', 'pow', 'sqrt' functions are supported via javascript 'Math' module */
+  /* Trigonometry */
+  /* 'cos', 'sin' and 'tan' functions are supported via javascript 'Math' module */
+  /* Random Numbers */
+  JERRYXX_BOOL_CHK(jerryx_register_global("randomSeed", js_random_seed));
+  JERRYXX_BOOL_CHK(jerryx_register_global("random", js_random));
+  /* Bits and Bytes */
+  JERRYXX_BOOL_CHK(jerryx_register_global("bit", js_bit));
+  JERRYXX_BOOL_CHK(jerryx_register_global("bitClear", js_bit_clear));
+  JERRYXX_BOOL_CHK(jerryx_register_global("bitRead", js_bit_read));
+  JERRYXX_BOOL_CHK(jerryx_register_global("bitSet", js_bit_set));
+  JERRYXX_BOOL_CHK(jerryx_register_global("bitWrite", js_bit_write));
+  JERRYXX_BOOL_CHK(jerryx_register_global("highByte", js_high_byte));
+  JERRYXX_BOOL_CHK(jerryx_register_global("lowByte", js_low_byte));
+  /* Analog I/O */
+  JERRYXX_BOOL_CHK(jerryx_register_global("analogRead", js_analog_read));
+  JERRYXX_BOOL_CHK(jerryx_register_global("analogWrite", js_analog_write));
+  JERRYXX_BOOL_CHK(jerryx_register_global("analogReadResolution", js_analog_read_resolution));
+  JERRYXX_BOOL_CHK(jerryx_register_global("analogWriteResolution", js_analog_write_resolution));
+
+  /* PwmOut */
+  {
+    const jerryx_property_entry pwm_out_methods[] =
+        {
+            {"duty", jerry_function_external(js_pwm_out_duty)},
+            {"close", jerry_function_external(js_pwm_out_close)},
+            {NULL, 0},
+        };
+    const jerryxx_getter_entry pwm_out_getters[] =
+        {
+            {"frequency", js_pwm_out_frequency},
+            {NULL, NULL},
+        };
+
+    JERRYXX_BOOL_CHK(jerryxx_register_global_class("PwmOut", js_pwm_out, pwm_out_methods, pwm_out_getters));
+  }
+
+  /* PwmGroup */
+  {
+    const jerryx_property_entry pwm_group_methods[] =
+        {
+            {"update", jerry_function_external(js_pwm_group_update)},
+            {NULL, 0},
+        };
+
+    JERRYXX_BOOL_CHK(jerryxx_register_global_class("PwmGroup", js_pwm_group, pwm_group_methods, NULL));
+  }
+
+  /* Advanced I/O */
+  JERRYXX_BOOL_CHK(jerryx_register_global("noTone", js_no_tone));
+  JERRYXX_BOOL_CHK(jerryx_register_global("pulseIn", js_pulse_in));
+  JERRYXX_BOOL_CHK(jerryx_register_global("pulseInLong", js_pulse_in_long));
+  JERRYXX_BOOL_CHK(jerryx_register_global("pulseInAsync", js_pulse_in_async));
+  JERRYXX_BOOL_CHK(jerryx_register_global("shiftIn", js_shift_in));
+  JERRYXX_BOOL_CHK(jerryx_register_global("shiftOut", js_shift_out));
+  JERRYXX_BOOL_CHK(jerryx_register_global("tone", js_tone));
+  JERRYXX_BOOL_CHK(jerryx_register_global("playSequence", js_play_sequence));
+  /* External Interrupts */
+  JERRYXX_BOOL_CHK(jerryx_register_global("attachInterrupt", js_attach_interrupt));
+  JERRYXX_BOOL_CHK(jerryx_register_global("detachInterrupt", js_detach_interrupt));
+  JERRYXX_BOOL_CHK(jerryx_register_global("getInterruptStats", js_get_interrupt_stats));
+  JERRYXX_BOOL_CHK(jerryx_register_global("getInterruptLatency", js_get_interrupt_latency));
+  JERRYXX_BOOL_CHK(jerryx_register_global("resetInterruptLatency", js_reset_interrupt_latency));
+
+  /* Encoder */
+  {
+    const jerryx_property_entry encoder_methods[] =
+        {
+            {"reset", jerry_function_external(js_encoder_reset)},
+            {"close", jerry_function_external(js_encoder_close)},
+            {NULL, 0},
+        };
+    const jerryxx_getter_entry encoder_getters[] =
+        {
+            {"position", js_encoder_position},
+            {"velocity", js_encoder_velocity},
+            {"overflows", js_encoder_overflows},
+            {"errors", js_encoder_errors},
+            {"hardware", js_encoder_hardware},
+            {NULL, NULL},
+        };
+
+    JERRYXX_BOOL_CHK(jerryxx_register_global_class("Encoder", js_encoder, encoder_methods, encoder_getters));
+  }
+
+  /* FrequencyCounter */
+  {
+    const jerryx_property_entry frequency_counter_methods[] =
+        {
+            {"reset", jerry_function_external(js_frequency_counter_reset)},
+            {"close", jerry_function_external(js_frequency_counter_close)},
+            {NULL, 0},
+        };
+    const jerryxx_getter_entry frequency_counter_getters[] =
+        {
+            {"frequency", js_frequency_counter_frequency},
+            {"period", js_frequency_counter_period},
+            {"duty", js_frequency_counter_duty},
+            {"minFrequency", js_frequency_counter_min_frequency},
+            {"maxFrequency", js_frequency_counter_max_frequency},
+            {"gates", js_frequency_counter_gates},
+            {"edges", js_frequency_counter_edges},
+            {NULL, NULL},
+        };
+
+    JERRYXX_BOOL_CHK(jerryxx_register_global_class("FrequencyCounter", js_frequency_counter, frequency_counter_methods, frequency_counter_getters));
+  }
+  /* Interrupts */
+  JERRYXX_BOOL_CHK(jerryx_register_global("interrupts", js_interrupts));
+  JERRYXX_BOOL_CHK(jerryx_register_global("noInterrupts", js_no_interrupts));
+  /* Characters */
+  JERRYXX_BOOL_CHK(jerryx_register_global("isAlpha", js_is_alpha));
+  JERRYXX_BOOL_CHK(jerryx_register_global("isAlphaNumeric", js_is_alpha_numeric));
+  JERRYXX_BOOL_CHK(jerryx_register_global("isAscii", js_is_ascii));
+  JERRYXX_BOOL_CHK(jerryx_register_global("isControl", js_is_control));
+  JERRYXX_BOOL_CHK(jerryx_register_global("isDigit", js_is_digit));
+  JERRYXX_BOOL_CHK(jerryx_register_global("isGraph", js_is_graph));
+  JERRYXX_BOOL_CHK(jerryx_register_global("isHexadecimalDigit", js_is_hexadecimal_digit));
+  JERRYXX_BOOL_CHK(jerryx_register_global("isLowerCase", js_is_lower_case));
+  JERRYXX_BOOL_CHK(jerryx_register_global("isPrintable", js_is_printable));
+  JERRYXX_BOOL_CHK(jerryx_register_global("isPunct", js_is_punct));
+  JERRYXX_BOOL_CHK(jerryx_register_global("isSpace", js_is_space));
+  JERRYXX_BOOL_CHK(jerryx_register_global("isUpperCase", js_is_upper_case));
+  JERRYXX_BOOL_CHK(jerryx_register_global("isWhitespace", js_is_whitespace));
+
+  /* Register Objects in the global object */
+
+  /* Communication */
+  /* Serial */
+  /* SPI */
+  /* Stream */
+  /* Wire */
+
+cleanup:
+  return ret;
+} /* jerryxx_register_arduino_api */
+
+/**
+ * Arduino: pinMode
+ */
+JERRYXX_DECLARE_FUNCTION(pin_mode)
+{
+  JERRYX_UNUSED(call_info_p);
+  uint32_t pin = 0;
+  uint32_t mode = 0;
+
+  const jerryx_arg_t mapping[] =
+      {
+          jerryx_arg_uint32(&pin, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+          jerryx_arg_uint32(&mode, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+      };
+
+  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
+  if (jerry_value_is_exception(rv))
+  {
+    return rv;
+  }
+
+  if (mode != INPUT && mode != OUTPUT && mode != INPUT_PULLUP && mode != INPUT_PULLDOWN)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'mode' must be INPUT, OUTPUT, INPUT_PULLUP or INPUT_PULLDOWN.");
+  }
+
+  pinMode(pin, mode);
+
+  return jerry_undefined();
+} /* js_pin_mode */
+
+/**
+ * Arduino: digitalWrite
+ */
+JERRYXX_DECLARE_FUNCTION(digital_write)
+{
+  JERRYX_UNUSED(call_info_p);
+  uint32_t pin = 0;
+  uint32_t value = 0;
+
+  const jerryx_arg_t mapping[] =
+      {
+          jerryx_arg_uint32(&pin, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+          jerryx_arg_uint32(&value, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_COERCE, JERRYX_ARG_REQUIRED),
+      };
+
+  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
+  if (jerry_value_is_exception(rv))
+  {
+    return rv;
+  }
+
+  if (value != HIGH && value != LOW)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'value' must be HIGH or LOW.");
+  }
+
+  digitalWrite(pin, value);
+
+  return jerry_undefined();
+} /* js_digital_write */
+
+/**
+ * Arduino: digitalWriteAt
+ */
+JERRYXX_DECLARE_FUNCTION(digital_write_at)
+{
+  JERRYX_UNUSED(call_info_p);
+  uint32_t pin = 0;
+  uint32_t value = 0;
+  uint32_t at_micros = 0;
+
+  const jerryx_arg_t mapping[] =
+      {
+          jerryx_arg_uint32(&pin, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+          jerryx_arg_uint32(&value, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_COERCE, JERRYX_ARG_REQUIRED),
+          jerryx_arg_uint32(&at_micros, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+      };
+
+  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
+  if (jerry_value_is_exception(rv))
+  {
+    return rv;
+  }
+
+  if (value != HIGH && value != LOW)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'value' must be HIGH or LOW.");
+  }
+
+  jerryxx_gpio_action_t action;
+  action.value = (uint8_t)value;
+
+  if (!jerryxx_gpio_from_pin(pin, &action.gpio))
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'pin' must be a digital pin.");
+  }
+
+  bool late = !jerryxx_gpio_action_time(at_micros, &action.at);
+
+  if (!jerryxx_gpio_action_schedule(&action, 1, late ? 1 : 0))
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "No digitalWriteAt slot free found.");
+  }
+
+  return jerry_undefined();
+} /* js_digital_write_at */
+
+/**
+ * Arduino: digitalWriteAtBatch
+ */
+JERRYXX_DECLARE_FUNCTION(digital_write_at_batch)
+{
+  JERRYX_UNUSED(call_info_p);
+  JERRYXX_ON_ARGS_COUNT_THROW_ERROR_SYNTAX(args_cnt != 1, "Wrong arguments count");
+  JERRYXX_ON_TYPE_CHECK_THROW_ERROR_TYPE(!jerry_value_is_array(args_p[0]), "Wrong argument 'actions' must be an array of [pin, value, atMicros].");
+
+  jerry_length_t count = jerry_array_length(args_p[0]);
+  uint32_t late = 0;
+
+  if (count > JERRYXX_GPIO_ACTION_QUEUE_SIZE)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "No digitalWriteAt slot free found.");
+  }
+
+  for (jerry_length_t idx = 0; idx < count; idx++)
+  {
+    uint32_t pin = 0;
+    uint32_t value = 0;
+    uint32_t at_micros = 0;
+
+    const jerryx_arg_t mapping[] =
+        {
+            jerryx_arg_uint32(&pin, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+            jerryx_arg_uint32(&value, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_COERCE, JERRYX_ARG_REQUIRED),
+            jerryx_arg_uint32(&at_micros, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+        };
+
+    jerry_value_t item = jerry_object_get_index(args_p[0], idx);
+    jerry_value_t rv = jerryx_arg_transform_array(item, mapping, JERRYXX_ARRAY_SIZE(mapping));
+    jerry_value_free(item);
+
+    if (jerry_value_is_exception(rv))
+    {
+      return rv;
+    }
+
+    if (value != HIGH && value != LOW)
+    {
+      return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'value' must be HIGH or LOW.");
+    }
+
+    jerryxx_gpio_action_t *action_p = &jerryxx_gpio_batch[idx];
+    action_p->value = (uint8_t)value;
+
+    if (!jerryxx_gpio_from_pin(pin, &action_p->gpio))
+    {
+      return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'pin' must be a digital pin.");
+    }
+
+    if (!jerryxx_gpio_action_time(at_micros, &action_p->at))
+    {
+      late++;
+    }
+  }
+
+  if (!jerryxx_gpio_action_schedule(jerryxx_gpio_batch, count, late))
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "No digitalWriteAt slot free found.");
+  }
+
+  return jerry_undefined();
+} /* js_digital_write_at_batch */
+
+/**
+ * Arduino: getDigitalWriteAtStats
+ */
+JERRYXX_DECLARE_FUNCTION(get_digital_write_at_stats)
+{
+  JERRYX_UNUSED(call_info_p);
+  JERRYX_UNUSED(args_p);
+  JERRYXX_ON_ARGS_COUNT_THROW_ERROR_SYNTAX(args_cnt != 0, "Wrong arguments count");
+
+  jerryxx_gpio_action_stats_t gpio_stats;
+  jerryxx_get_gpio_action_stats(&gpio_stats);
+
+  jerry_value_t stats = jerry_object();
+  jerryxx_object_set_number(stats, "pending", gpio_stats.pending);
+  jerryxx_object_set_number(stats, "queued", gpio_stats.queued);
+  jerryxx_object_set_number(stats, "fired", gpio_stats.fired);
+  jerryxx_object_set_number(stats, "late", gpio_stats.late);
+  jerryxx_object_set_number(stats, "maxError", gpio_stats.max_error);
+
+  return stats;
+} /* js_get_digital_write_at_stats */
+
+/**
+ * Arduino: digitalRead
+ */
+JERRYXX_DECLARE_FUNCTION(digital_read)
+{
+  JERRYX_UNUSED(call_info_p);
+  uint32_t pin = 0;
+
+  const jerryx_arg_t mapping[] =
+      {
+          jerryx_arg_uint32(&pin, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+      };
+
+  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
+  if (jerry_value_is_exception(rv))
+  {
+    return rv;
+  }
+
+  return jerry_number(digitalRead(pin));
+} /* js_digital_read */
+
+/**
+ * Arduino: DigitalOut
+ */
+JERRYXX_DECLARE_FUNCTION(digital_out)
+{
+  uint32_t pin = 0;
+  uint32_t value = LOW;
+
+  if (jerry_value_is_undefined(call_info_p->new_target))
+  {
+    return jerry_throw_sz(JERRY_ERROR_TYPE, "Constructor DigitalOut requires 'new'.");
+  }
+
+  const jerryx_arg_t mapping[] =
+      {
+          jerryx_arg_uint32(&pin, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+          jerryx_arg_uint32(&value, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_COERCE, JERRYX_ARG_OPTIONAL),
+      };
+
+  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
+  if (jerry_value_is_exception(rv))
+  {
+    return rv;
+  }
+
+  jerryxx_gpio_t *gpio_p = new jerryxx_gpio_t;
+
+  if (!jerryxx_gpio_from_pin(pin, gpio_p))
+  {
+    delete gpio_p;
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'pin' must be a pin.");
+  }
+
+  if (value != HIGH && value != LOW)
+  {
+    delete gpio_p;
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'value' must be HIGH or LOW.");
+  }
+
+  pinMode(pin, OUTPUT);
+  jerryxx_gpio_write(gpio_p, value);
+  jerry_object_set_native_ptr(call_info_p->this_value, &jerryxx_digital_out_info, gpio_p);
+
+  return jerry_undefined();
+} /* js_digital_out */
+
+/**
+ * Arduino: DigitalOut.prototype.write
+ */
+JERRYXX_DECLARE_FUNCTION(digital_out_write)
+{
+  JERRYXX_ON_ARGS_COUNT_THROW_ERROR_SYNTAX(args_cnt != 1, "Wrong arguments count");
+
+  JERRYXX_GET_NATIVE_THIS_OR_THROW_ERROR_TYPE(jerryxx_gpio_t, gpio_p, jerryxx_digital_out_info, "Wrong 'this' must be a DigitalOut.");
+
+  /* HIGH and true drive the pin high, LOW and false drive it low */
+  jerryxx_gpio_write(gpio_p, jerry_value_to_boolean(args_p[0]) ? HIGH : LOW);
+
+  return jerry_undefined();
+} /* js_digital_out_write */
+
+/**
+ * Arduino: DigitalOut.prototype.read
+ */
+JERRYXX_DECLARE_FUNCTION(digital_out_read)
+{
+  JERRYX_UNUSED(args_p);
+  JERRYXX_ON_ARGS_COUNT_THROW_ERROR_SYNTAX(args_cnt != 0, "Wrong arguments count");
+
+  JERRYXX_GET_NATIVE_THIS_OR_THROW_ERROR_TYPE(jerryxx_gpio_t, gpio_p, jerryxx_digital_out_info, "Wrong 'this' must be a DigitalOut.");
+
+  /* The level last written, not the level sensed on the pin */
+  return jerry_number((gpio_p->port_p->ODR & gpio_p->mask) ? HIGH : LOW);
+} /* js_digital_out_read */
+
+/**
+ * Arduino: DigitalOut.prototype.toggle
+ */
+JERRYXX_DECLARE_FUNCTION(digital_out_toggle)
+{
+  JERRYX_UNUSED(args_p);
+  JERRYXX_ON_ARGS_COUNT_THROW_ERROR_SYNTAX(args_cnt != 0, "Wrong arguments count");
+
+  JERRYXX_GET_NATIVE_THIS_OR_THROW_ERROR_TYPE(jerryxx_gpio_t, gpio_p, jerryxx_digital_out_info, "Wrong 'this' must be a DigitalOut.");
+
+  jerryxx_gpio_write(gpio_p, (gpio_p->port_p->ODR & gpio_p->mask) ? LOW : HIGH);
+
+  return jerry_undefined();
+} /* js_digital_out_toggle */
+
+/**
+ * Arduino: DigitalIn
+ */
+JERRYXX_DECLARE_FUNCTION(digital_in)
+{
+  uint32_t pin = 0;
+  uint32_t mode = INPUT;
+
+  if (jerry_value_is_undefined(call_info_p->new_target))
+  {
+    return jerry_throw_sz(JERRY_ERROR_TYPE, "Constructor DigitalIn requires 'new'.");
+  }
+
+  const jerryx_arg_t mapping[] =
+      {
+          jerryx_arg_uint32(&pin, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+          jerryx_arg_uint32(&mode, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_OPTIONAL),
+      };
+
+  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
+  if (jerry_value_is_exception(rv))
+  {
+    return rv;
+  }
+
+  jerryxx_gpio_t *gpio_p = new jerryxx_gpio_t;
+
+  if (!jerryxx_gpio_from_pin(pin, gpio_p))
+  {
+    delete gpio_p;
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'pin' must be a pin.");
+  }
+
+  if (mode != INPUT && mode != INPUT_PULLUP && mode != INPUT_PULLDOWN)
+  {
+    delete gpio_p;
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'mode' must be INPUT, INPUT_PULLUP or INPUT_PULLDOWN.");
+  }
+
+  pinMode(pin, mode);
+  jerry_object_set_native_ptr(call_info_p->this_value, &jerryxx_digital_in_info, gpio_p);
+
+  return jerry_undefined();
+} /* js_digital_in */
+
+/**
+ * Arduino: DigitalIn.prototype.read
+ */
+JERRYXX_DECLARE_FUNCTION(digital_in_read)
+{
+  JERRYX_UNUSED(args_p);
+  JERRYXX_ON_ARGS_COUNT_THROW_ERROR_SYNTAX(args_cnt != 0, "Wrong arguments count");
+
+  JERRYXX_GET_NATIVE_THIS_OR_THROW_ERROR_TYPE(jerryxx_gpio_t, gpio_p, jerryxx_digital_in_info, "Wrong 'this' must be a DigitalIn.");
+
+  return jerry_number(jerryxx_gpio_read(gpio_p));
+} /* js_digital_in_read */
+
+/**
+ * Arduino: digitalPinToPort
+ */
+JERRYXX_DECLARE_FUNCTION(digital_pin_to_port)
+{
+  JERRYX_UNUSED(call_info_p);
+  uint32_t pin = 0;
+
+  const jerryx_arg_t mapping[] =
+      {
+          jerryx_arg_uint32(&pin, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+      };
+
+  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
+  if (jerry_value_is_exception(rv))
+  {
+    return rv;
+  }
+
+  if (pin >= PINS_COUNT || digitalPinToPinName((pin_size_t)pin) == NC)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'pin' must be a pin.");
+  }
+
+  return jerry_number(STM_PORT(digitalPinToPinName((pin_size_t)pin)));
+} /* js_digital_pin_to_port */
+
+/**
+ * Arduino: digitalPinToBitMask
+ */
+JERRYXX_DECLARE_FUNCTION(digital_pin_to_bit_mask)
+{
+  JERRYX_UNUSED(call_info_p);
+  uint32_t pin = 0;
+
+  const jerryx_arg_t mapping[] =
+      {
+          jerryx_arg_uint32(&pin, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+      };
+
+  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
+  if (jerry_value_is_exception(rv))
+  {
+    return rv;
+  }
+
+  jerryxx_gpio_t gpio;
+
+  if (!jerryxx_gpio_from_pin(pin, &gpio))
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'pin' must be a pin.");
+  }
+
+  return jerry_number(gpio.mask);
+} /* js_digital_pin_to_bit_mask */
+
+/**
+ * Arduino: portWrite
+ */
+JERRYXX_DECLARE_FUNCTION(port_write)
+{
+  JERRYX_UNUSED(call_info_p);
+  uint32_t port = 0;
+  uint32_t mask = 0;
+  uint32_t value = 0;
+
+  const jerryx_arg_t mapping[] =
+      {
+          jerryx_arg_uint32(&port, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+          jerryx_arg_uint32(&mask, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+          jerryx_arg_uint32(&value, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+      };
+
+  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
+  if (jerry_value_is_exception(rv))
+  {
+    return rv;
+  }
+
+  if (port >= JERRYXX_GPIO_PORT_COUNT)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'port' must be between PORTA and PORTK.");
+  }
+
+  if (mask > 0xFFFF)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'mask' must be between 0 and 0xFFFF.");
+  }
+
+  /* One write of the bit set/reset register: the pins of the mask change together */
+  Set_GPIO_Clock(port)->BSRR = (value & mask) | ((~value & mask) << 16);
+
+  return jerry_undefined();
+} /* js_port_write */
+
+/**
+ * Arduino: portRead
+ */
+JERRYXX_DECLARE_FUNCTION(port_read)
+{
+  JERRYX_UNUSED(call_info_p);
+  uint32_t port = 0;
+
+  const jerryx_arg_t mapping[] =
+      {
+          jerryx_arg_uint32(&port, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+      };
+
+  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
+  if (jerry_value_is_exception(rv))
+  {
+    return rv;
+  }
+
+  if (port >= JERRYXX_GPIO_PORT_COUNT)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'port' must be between PORTA and PORTK.");
+  }
+
+  return jerry_number(Set_GPIO_Clock(port)->IDR & 0xFFFF);
+} /* js_port_read */
+
+/**
+ * Resolve an array of pins into a group and set their mode.
+ *
+ * @return undefined - if the operation was successful,
+ *         RangeError - otherwise.
+ */
+static jerry_value_t
+jerryxx_pin_group_from_array(const jerry_value_t pins,     /**< array of Arduino pins, its length checked by the caller */
+                             uint32_t mode,                /**< mode of the pins, checked by the caller */
+                             jerryxx_pin_group_t *group_p) /**< [out] group */
+{
+  jerry_length_t count = jerry_array_length(pins);
+  uint32_t pin_numbers[JERRYXX_PIN_GROUP_MAX];
+  group_p->port_count = 0;
+  group_p->pin_count = 0;
+
+  for (jerry_length_t idx = 0; idx < count; idx++)
+  {
+    jerry_value_t item = jerry_object_get_index(pins, idx);
+    double number = jerry_value_is_number(item) ? jerry_value_as_number(item) : -1.0;
+    jerry_value_free(item);
+
+    /* Only whole numbers in range are converted: NaN, negative or fractional pins are rejected */
+    bool is_pin = number >= 0.0 && number < PINS_COUNT && number == (double)(uint32_t)number;
+    pin_numbers[idx] = is_pin ? (uint32_t)number : PINS_COUNT;
+
+    if (!jerryxx_pin_group_add(group_p, pin_numbers[idx]))
+    {
+      return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'pins' must be an array of different pins.");
+    }
+  }
+
+  for (jerry_length_t idx = 0; idx < count; idx++)
+  {
+    pinMode(pin_numbers[idx], mode);
+  }
+
+  return jerry_undefined();
+} /* jerryxx_pin_group_from_array */
+
+/**
+ * Arduino: PinGroup
+ */
+JERRYXX_DECLARE_FUNCTION(pin_group)
+{
+  uint32_t mode = OUTPUT;
+
+  if (jerry_value_is_undefined(call_info_p->new_target))
+  {
+    return jerry_throw_sz(JERRY_ERROR_TYPE, "Constructor PinGroup requires 'new'.");
+  }
+
+  JERRYXX_ON_ARGS_COUNT_THROW_ERROR_SYNTAX(args_cnt < 1 || args_cnt > 2, "Wrong arguments count");
+  JERRYXX_ON_TYPE_CHECK_THROW_ERROR_TYPE(!jerry_value_is_array(args_p[0]), "Wrong argument 'pins' must be an array of pins.");
+
+  if (args_cnt > 1)
+  {
+    const jerryx_arg_t mapping[] =
+        {
+            jerryx_arg_uint32(&mode, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+        };
+
+    const jerry_value_t rv = jerryx_arg_transform_args(args_p + 1, args_cnt - 1, mapping, JERRYXX_ARRAY_SIZE(mapping));
+    if (jerry_value_is_exception(rv))
+    {
+      return rv;
+    }
+  }
+
+  if (mode != INPUT && mode != OUTPUT && mode != INPUT_PULLUP && mode != INPUT_PULLDOWN)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'mode' must be INPUT, OUTPUT, INPUT_PULLUP or INPUT_PULLDOWN.");
+  }
+
+  jerry_length_t count = jerry_array_length(args_p[0]);
+
+  if (count == 0 || count > JERRYXX_PIN_GROUP_MAX)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'pins' must have between 1 and 32 pins.");
+  }
+
+  jerryxx_pin_group_t *group_p = new jerryxx_pin_group_t;
+  jerry_value_t result = jerryxx_pin_group_from_array(args_p[0], mode, group_p);
+
+  if (jerry_value_is_exception(result))
+  {
+    delete group_p;
+    return result;
+  }
+
+  jerry_object_set_native_ptr(call_info_p->this_value, &jerryxx_pin_group_info, group_p);
+
+  return result;
+} /* js_pin_group */
+
+/**
+ * Arduino: PinGroup.prototype.write
+ */
+JERRYXX_DECLARE_FUNCTION(pin_group_write)
+{
+  JERRYXX_ON_ARGS_COUNT_THROW_ERROR_SYNTAX(args_cnt != 1, "Wrong arguments count");
+  JERRYXX_ON_TYPE_CHECK_THROW_ERROR_TYPE(!jerry_value_is_number(args_p[0]), "Wrong argument 'bits' must be a number.");
+
+  JERRYXX_GET_NATIVE_THIS_OR_THROW_ERROR_TYPE(jerryxx_pin_group_t, group_p, jerryxx_pin_group_info, "Wrong 'this' must be a PinGroup.");
+
+  jerryxx_pin_group_write(group_p, jerry_value_as_uint32(args_p[0]));
+
+  return jerry_undefined();
+} /* js_pin_group_write */
+
+/**
+ * Arduino: PinGroup.prototype.read
+ */
+JERRYXX_DECLARE_FUNCTION(pin_group_read)
+{
+  JERRYX_UNUSED(args_p);
+  JERRYXX_ON_ARGS_COUNT_THROW_ERROR_SYNTAX(args_cnt != 0, "Wrong arguments count");
+
+  JERRYXX_GET_NATIVE_THIS_OR_THROW_ERROR_TYPE(jerryxx_pin_group_t, group_p, jerryxx_pin_group_info, "Wrong 'this' must be a PinGroup.");
+
+  return jerry_number(jerryxx_pin_group_read(group_p));
+} /* js_pin_group_read */
+
+/**
+ * Arduino: WaveformOut
+ */
+JERRYXX_DECLARE_FUNCTION(waveform_out)
+{
+  uint32_t sample_rate = 0;
+
+  if (jerry_value_is_undefined(call_info_p->new_target))
+  {
+    return jerry_throw_sz(JERRY_ERROR_TYPE, "Constructor WaveformOut requires 'new'.");
+  }
+
+  JERRYXX_ON_ARGS_COUNT_THROW_ERROR_SYNTAX(args_cnt != 2, "Wrong arguments count");
+  JERRYXX_ON_TYPE_CHECK_THROW_ERROR_TYPE(!jerry_value_is_array(args_p[0]), "Wrong argument 'pins' must be an array of pins.");
+
+  const jerryx_arg_t mapping[] =
+      {
+          jerryx_arg_uint32(&sample_rate, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+      };
+
+  const jerry_value_t rv = jerryx_arg_transform_args(args_p + 1, args_cnt - 1, mapping, JERRYXX_ARRAY_SIZE(mapping));
+  if (jerry_value_is_exception(rv))
+  {
+    return rv;
+  }
+
+  if (sample_rate == 0 || sample_rate > JERRYXX_WAVEFORM_RATE_MAX)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'sampleRateHz' must be between 1 and JERRYXX_WAVEFORM_RATE_MAX.");
+  }
+
+  /* The ticker counts whole microseconds: any other rate would be played off pitch */
+  if (1000000 % sample_rate != 0)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'sampleRateHz' must divide 1000000, the period being whole microseconds.");
+  }
+
+  jerry_length_t count = jerry_array_length(args_p[0]);
+
+  if (count == 0 || count > 16)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'pins' must have between 1 and 16 pins.");
+  }
+
+  jerryxx_waveform_t *waveform_p = jerryxx_waveform_alloc();
+
+  if (waveform_p == NULL)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "No WaveformOut slot free found.");
+  }
+
+  jerry_value_t result = jerryxx_pin_group_from_array(args_p[0], OUTPUT, &waveform_p->group);
+
+  if (jerry_value_is_exception(result))
+  {
+    waveform_p->allocated = false;
+    return result;
+  }
+
+  waveform_p->period_us = 1000000 / sample_rate;
+  jerry_object_set_native_ptr(call_info_p->this_value, &jerryxx_waveform_info, waveform_p);
+
+  return result;
+} /* js_waveform_out */
+
+/**
+ * Start a WaveformOut from the arguments of play or loop: samples and optional callback.
+ *
+ * @return undefined - if the operation was successful,
+ *         error - otherwise.
+ */
+static jerry_value_t
+jerryxx_waveform_start(const jerry_call_info_t *call_info_p, /**< call information */
+                       const jerry_value_t args_p[],         /**< function arguments */
+                       const jerry_length_t args_cnt,        /**< number of function arguments */
+                       bool loop)                            /**< circular */
+{
+  JERRYXX_ON_ARGS_COUNT_THROW_ERROR_SYNTAX(args_cnt < 1 || args_cnt > 2, "Wrong arguments count");
+  JERRYXX_ON_TYPE_CHECK_THROW_ERROR_TYPE(args_cnt > 1 && !jerry_value_is_function(args_p[1]), "Wrong argument 'callback' must be a function.");
+
+  JERRYXX_GET_NATIVE_THIS_OR_THROW_ERROR_TYPE(jerryxx_waveform_t, waveform_p, jerryxx_waveform_info, "Wrong 'this' must be a WaveformOut.");
+
+  jerry_typedarray_type_t type = jerry_value_is_typedarray(args_p[0]) ? jerry_typedarray_type(args_p[0]) : JERRY_TYPEDARRAY_INVALID;
+
+  if (type != JERRY_TYPEDARRAY_UINT8 && type != JERRY_TYPEDARRAY_UINT16)
+  {
+    return jerry_throw_sz(JERRY_ERROR_TYPE, "Wrong argument 'samples' must be a Uint8Array or a Uint16Array.");
+  }
+
+  jerry_length_t length = 0;
+  const uint8_t *data_p = (const uint8_t *)jerryxx_typedarray_data(args_p[0], type, &length);
+
+  if (data_p == NULL || length == 0)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'samples' must not be empty.");
+  }
+
+  /* Played in place: changes to the array are heard at the next pass */
+  jerry_value_t callback_fn = args_cnt > 1 ? args_p[1] : jerry_undefined();
+  uint8_t width = type == JERRY_TYPEDARRAY_UINT16 ? 2 : 1;
+  jerryxx_waveform_play(waveform_p, call_info_p->this_value, args_p[0], data_p, length, width, callback_fn, loop);
+
+  return jerry_undefined();
+} /* jerryxx_waveform_start */
+
+/**
+ * Arduino: WaveformOut.prototype.play
+ */
+JERRYXX_DECLARE_FUNCTION(waveform_out_play)
+{
+  return jerryxx_waveform_start(call_info_p, args_p, args_cnt, false);
+} /* js_waveform_out_play */
+
+/**
+ * Arduino: WaveformOut.prototype.loop
+ */
+JERRYXX_DECLARE_FUNCTION(waveform_out_loop)
+{
+  return jerryxx_waveform_start(call_info_p, args_p, args_cnt, true);
+} /* js_waveform_out_loop */
+
+/**
+ * Arduino: WaveformOut.prototype.stop
+ */
+JERRYXX_DECLARE_FUNCTION(waveform_out_stop)
+{
+  JERRYX_UNUSED(args_p);
+  JERRYXX_ON_ARGS_COUNT_THROW_ERROR_SYNTAX(args_cnt != 0, "Wrong arguments count");
+
+  JERRYXX_GET_NATIVE_THIS_OR_THROW_ERROR_TYPE(jerryxx_waveform_t, waveform_p, jerryxx_waveform_info, "Wrong 'this' must be a WaveformOut.");
+
+  jerryxx_waveform_stop(waveform_p);
+  return jerry_undefined();
+} /* js_waveform_out_stop */
+
+/**
+ * Arduino: WaveformOut.prototype.close
+ */
+JERRYXX_DECLARE_FUNCTION(waveform_out_close)
+{
+  JERRYX_UNUSED(args_p);
+  JERRYXX_ON_ARGS_COUNT_THROW_ERROR_SYNTAX(args_cnt != 0, "Wrong arguments count");
+
+  JERRYXX_GET_NATIVE_THIS_OR_THROW_ERROR_TYPE(jerryxx_waveform_t, waveform_p, jerryxx_waveform_info, "Wrong 'this' must be a WaveformOut.");
+
+  /* Give the slot back now rather than when the object is collected */
+  jerry_object_delete_native_ptr(call_info_p->this_value, &jerryxx_waveform_info);
+  jerryxx_waveform_stop(waveform_p);
+  waveform_p->allocated = false;
+
+  return jerry_undefined();
+} /* js_waveform_out_close */
+
+/**
+ * Arduino: WaveformOut.prototype.playing
+ */
+JERRYXX_DECLARE_FUNCTION(waveform_out_playing)
+{
+  JERRYX_UNUSED(args_p);
+  JERRYX_UNUSED(args_cnt);
+
+  JERRYXX_GET_NATIVE_THIS_OR_THROW_ERROR_TYPE(jerryxx_waveform_t, waveform_p, jerryxx_waveform_info, "Wrong 'this' must be a WaveformOut.");
+
+  return jerry_boolean(waveform_p->running);
+} /* js_waveform_out_playing */
+
+/**
+ * Arduino: WaveformOut.prototype.passes
+ */
+JERRYXX_DECLARE_FUNCTION(waveform_out_passes)
+{
+  JERRYX_UNUSED(args_p);
+  JERRYX_UNUSED(args_cnt);
+
+  JERRYXX_GET_NATIVE_THIS_OR_THROW_ERROR_TYPE(jerryxx_waveform_t, waveform_p, jerryxx_waveform_info, "Wrong 'this' must be a WaveformOut.");
+
+  return jerry_number(waveform_p->passes);
+} /* js_waveform_out_passes */
+
+/**
+ * Arduino: delay
+ */
+JERRYXX_DECLARE_FUNCTION(delay)
+{
+  JERRYX_UNUSED(call_info_p);
+  uint32_t value = 0;
+
+  const jerryx_arg_t mapping[] =
+      {
+          jerryx_arg_uint32(&value, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+      };
+
+  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
+  if (jerry_value_is_exception(rv))
+  {
+    return rv;
+  }
+
+  delay(value);
+
+  return jerry_undefined();
+} /* js_delay */
+
+/**
+ * Arduino: delayMicroseconds
+ */
+JERRYXX_DECLARE_FUNCTION(delay_microseconds)
+{
+  JERRYX_UNUSED(call_info_p);
+  uint32_t value = 0;
+
+  const jerryx_arg_t mapping[] =
+      {
+          jerryx_arg_uint32(&value, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+      };
+
+  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
+  if (jerry_value_is_exception(rv))
+  {
+    return rv;
+  }
+
+  delayMicroseconds(value);
+
+  return jerry_undefined();
+} /* js_delay_microseconds */
+
+/**
+ * Arduino: micros
+ */
+JERRYXX_DECLARE_FUNCTION(micros)
+{
+  JERRYX_UNUSED(call_info_p);
+  JERRYX_UNUSED(args_p);
+  JERRYXX_ON_ARGS_COUNT_THROW_ERROR_SYNTAX(args_cnt != 0, "Wrong arguments count");
+
+  return jerry_number(micros());
+} /* js_micros */
+
+/**
+ * Arduino: millis
+ */
+JERRYXX_DECLARE_FUNCTION(millis)
+{
+  JERRYX_UNUSED(call_info_p);
+  JERRYX_UNUSED(args_p);
+  JERRYXX_ON_ARGS_COUNT_THROW_ERROR_SYNTAX(args_cnt != 0, "Wrong arguments count");
+
+  return jerry_number(millis());
+} /* js_millis */
+
+/**
+ * Arduino: randomSeed
+ */
+JERRYXX_DECLARE_FUNCTION(random_seed)
+{
+  JERRYX_UNUSED(call_info_p);
+  uint32_t seed = 0;
+
+  const jerryx_arg_t mapping[] =
+      {
+          jerryx_arg_uint32(&seed, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+      };
+
+  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
+  if (jerry_value_is_exception(rv))
+  {
+    return rv;
+  }
+
+  randomSeed(seed);
+
+  return jerry_undefined();
+} /* js_random_seed */
+
+/**
+ * Arduino: random
+ */
+JERRYXX_DECLARE_FUNCTION(random)
+{
+  JERRYX_UNUSED(call_info_p);
+  uint32_t a = 0;
+  uint32_t b = 0;
+
+  const jerryx_arg_t mapping[] =
+      {
+          jerryx_arg_uint32(&a, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+          jerryx_arg_uint32(&b, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_OPTIONAL),
+      };
+
+  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
+  if (jerry_value_is_exception(rv))
+  {
+    return rv;
+  }
+
+  if (args_cnt == 1)
+  {
+    return jerry_number(random(a));
+  }
+  else if (args_cnt == 2)
+  {
+    return jerry_number(random(a, b));
+  }
+
+  return jerry_number(0);
+} /* js_random */
 
-  /* PINs Mode */
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("INPUT", jerry_number(INPUT), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("OUTPUT", jerry_number(OUTPUT), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("INPUT_PULLUP", jerry_number(INPUT_PULLUP), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("INPUT_PULLDOWN", jerry_number(INPUT_PULLDOWN), true));
-#if defined(OUTPUT_OPENDRAIN)
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("OUTPUT_OPENDRAIN", jerry_number(OUTPUT_OPENDRAIN), true));
-#endif
+/**
+ * Arduino: analogRead
+ */
+JERRYXX_DECLARE_FUNCTION(analog_read)
+{
+  JERRYX_UNUSED(call_info_p);
+  uint32_t pin = 0;
 
-  /* LEDs */
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("PIN_LED", jerry_number(PIN_LED), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("LED_BUILTIN", jerry_number(LED_BUILTIN), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("LEDR", jerry_number(LEDR), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("LEDG", jerry_number(LEDG), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("LEDB", jerry_number(LEDB), true));
+  const jerryx_arg_t mapping[] =
+      {
+          jerryx_arg_uint32(&pin, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+      };
 
-  /* Analog pins */
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("A0", jerry_number(A0), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("A1", jerry_number(A1), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("A2", jerry_number(A2), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("A3", jerry_number(A3), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("A4", jerry_number(A4), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("A5", jerry_number(A5), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("A6", jerry_number(A6), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("A7", jerry_number(A7), true));
+  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
+  if (jerry_value_is_exception(rv))
+  {
+    return rv;
+  }
 
-  /* Digital pins */
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D0", jerry_number(D0), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D1", jerry_number(D1), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D2", jerry_number(D2), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D3", jerry_number(D3), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D4", jerry_number(D4), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D5", jerry_number(D5), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D6", jerry_number(D6), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D7", jerry_number(D7), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D8", jerry_number(D8), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D9", jerry_number(D9), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D10", jerry_number(D10), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D11", jerry_number(D11), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D12", jerry_number(D12), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D13", jerry_number(D13), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D14", jerry_number(D14), true));
-/* Pin D15, D16, D17 and D18 cannot be used as digital pin.*/
-/*
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D15", jerry_number (D15), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D16", jerry_number (D16), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D17", jerry_number (D17), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D18", jerry_number (D18), true));
+  return jerry_number(analogRead(pin));
+} /* js_analog_read */
+
+/**
+ * Arduino: analogWrite
  */
-#if defined(CORE_CM7)
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D19", jerry_number(D19), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D20", jerry_number(D20), true));
-  JERRYXX_BOOL_CHK(jerryxx_register_global_property("D21", jerry_number(D21), true));
-#endif
+JERRYXX_DECLARE_FUNCTION(analog_write)
+{
+  JERRYX_UNUSED(call_info_p);
+  uint32_t pin = 0;
+  uint32_t value = 0;
 
-  /* Register Functions in the global object */
+  const jerryx_arg_t mapping[] =
+      {
+          jerryx_arg_uint32(&pin, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+          jerryx_arg_uint32(&value, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+      };
 
-  /* Digital I/O */
-  JERRYXX_BOOL_CHK(jerryx_register_global("pinMode", js_pin_mode));
-  JERRYXX_BOOL_CHK(jerryx_register_global("digitalWrite", js_digital_write));
-  JERRYXX_BOOL_CHK(jerryx_register_global("digitalRead", js_digital_read));
-  /* Time */
-  JERRYXX_BOOL_CHK(jerryx_register_global("delay", js_delay));
-  JERRYXX_BOOL_CHK(jerryx_register_global("delayMicroseconds", js_delay_microseconds));
-  JERRYXX_BOOL_CHK(jerryx_register_global("micros", js_micros));
-  JERRYXX_BOOL_CHK(jerryx_register_global("millis", js_millis));
-  /* Math */
-  JERRYXX_BOOL_CHK(jerryx_register_global("constrain", js_constrain));
-  JERRYXX_BOOL_CHK(jerryx_register_global("map", js_map));
-  JERRYXX_BOOL_CHK(jerryx_register_global("sq", js_sq));
-  /* 'abs', 'max', 'min', 'pow', 'sqrt' functions are supported via javascript 'Math' module */
-  /* Trigonometry */
-  /* 'cos', 'sin' and 'tan' functions are supported via javascript 'Math' module */
-  /* Random Numbers */
-  JERRYXX_BOOL_CHK(jerryx_register_global("randomSeed", js_random_seed));
-  JERRYXX_BOOL_CHK(jerryx_register_global("random", js_random));
-  /* Bits and Bytes */
-  JERRYXX_BOOL_CHK(jerryx_register_global("bit", js_bit));
-  JERRYXX_BOOL_CHK(jerryx_register_global("bitClear", js_bit_clear));
-  JERRYXX_BOOL_CHK(jerryx_register_global("bitRead", js_bit_read));
-  JERRYXX_BOOL_CHK(jerryx_register_global("bitSet", js_bit_set));
-  JERRYXX_BOOL_CHK(jerryx_register_global("bitWrite", js_bit_write));
-  JERRYXX_BOOL_CHK(jerryx_register_global("highByte", js_high_byte));
-  JERRYXX_BOOL_CHK(jerryx_register_global("lowByte", js_low_byte));
-  /* Analog I/O */
-  JERRYXX_BOOL_CHK(jerryx_register_global("analogRead", js_analog_read));
-  JERRYXX_BOOL_CHK(jerryx_register_global("analogWrite", js_analog_write));
-  JERRYXX_BOOL_CHK(jerryx_register_global("analogReadResolution", js_analog_read_resolution));
-  JERRYXX_BOOL_CHK(jerryx_register_global("analogWriteResolution", js_analog_write_resolution));
-  /* Advanced I/O */
-  JERRYXX_BOOL_CHK(jerryx_register_global("noTone", js_no_tone));
-  JERRYXX_BOOL_CHK(jerryx_register_global("pulseIn", js_pulse_in));
-  JERRYXX_BOOL_CHK(jerryx_register_global("pulseInLong", js_pulse_in_long));
-  JERRYXX_BOOL_CHK(jerryx_register_global("shiftIn", js_shift_in));
-  JERRYXX_BOOL_CHK(jerryx_register_global("shiftOut", js_shift_out));
-  JERRYXX_BOOL_CHK(jerryx_register_global("tone", js_tone));
-  /* External Interrupts */
-  JERRYXX_BOOL_CHK(jerryx_register_global("attachInterrupt", js_attach_interrupt));
-  JERRYXX_BOOL_CHK(jerryx_register_global("detachInterrupt", js_detach_interrupt));
-  /* Interrupts */
-  JERRYXX_BOOL_CHK(jerryx_register_global("interrupts", js_interrupts));
-  JERRYXX_BOOL_CHK(jerryx_register_global("noInterrupts", js_no_interrupts));
-  /* Characters */
-  JERRYXX_BOOL_CHK(jerryx_register_global("isAlpha", js_is_alpha));
-  JERRYXX_BOOL_CHK(jerryx_register_global("isAlphaNumeric", js_is_alpha_numeric));
-  JERRYXX_BOOL_CHK(jerryx_register_global("isAscii", js_is_ascii));
-  JERRYXX_BOOL_CHK(jerryx_register_global("isControl", js_is_control));
-  JERRYXX_BOOL_CHK(jerryx_register_global("isDigit", js_is_digit));
-  JERRYXX_BOOL_CHK(jerryx_register_global("isGraph", js_is_graph));
-  JERRYXX_BOOL_CHK(jerryx_register_global("isHexadecimalDigit", js_is_hexadecimal_digit));
-  JERRYXX_BOOL_CHK(jerryx_register_global("isLowerCase", js_is_lower_case));
-  JERRYXX_BOOL_CHK(jerryx_register_global("isPrintable", js_is_printable));
-  JERRYXX_BOOL_CHK(jerryx_register_global("isPunct", js_is_punct));
-  JERRYXX_BOOL_CHK(jerryx_register_global("isSpace", js_is_space));
-  JERRYXX_BOOL_CHK(jerryx_register_global("isUpperCase", js_is_upper_case));
-  JERRYXX_BOOL_CHK(jerryx_register_global("isWhitespace", js_is_whitespace));
+  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
+  if (jerry_value_is_exception(rv))
+  {
+    return rv;
+  }
 
-  /* Register Objects in the global object */
+  /* The core would set the period of a timer counting an Encoder or driving PwmOut channels */
+  PinName name = pin < PINS_COUNT ? digitalPinToPinName((pin_size_t)pin) : NC;
+  uint32_t tim = name != NC ? pinmap_find_peripheral(name, PinMap_PWM) : (uint32_t)NC;
 
-  /* Communication */
-  /* Serial */
-  /* SPI */
-  /* Stream */
-  /* Wire */
+  if (tim != (uint32_t)NC && jerryxx_tim_user((TIM_TypeDef *)(uintptr_t)tim) != JERRYXX_TIM_FREE)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'pin' must not be on the timer of an Encoder or a PwmOut.");
+  }
 
-cleanup:
-  return ret;
-} /* jerryxx_register_arduino_api */
+  analogWrite(pin, value);
+
+  return jerry_undefined();
+} /* js_analog_write */
+
+/**
+ * Arduino: PwmOut
+ */
+JERRYXX_DECLARE_FUNCTION(pwm_out)
+{
+  uint32_t pin = 0;
+  uint32_t frequency = 500;
+  uint32_t resolution = 0;
+
+  if (jerry_value_is_undefined(call_info_p->new_target))
+  {
+    return jerry_throw_sz(JERRY_ERROR_TYPE, "Constructor PwmOut requires 'new'.");
+  }
+
+  const char *options_names[] = {"frequency", "resolution"};
+  const jerryx_arg_t options_mapping[] =
+      {
+          jerryx_arg_uint32(&frequency, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_OPTIONAL),
+          jerryx_arg_uint32(&resolution, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_OPTIONAL),
+      };
+  const jerryx_arg_object_props_t options =
+      {
+          (const jerry_char_t **)options_names,
+          JERRYXX_ARRAY_SIZE(options_names),
+          options_mapping,
+          JERRYXX_ARRAY_SIZE(options_mapping),
+      };
+
+  const jerryx_arg_t mapping[] =
+      {
+          jerryx_arg_uint32(&pin, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+          jerryx_arg_object_properties(&options, JERRYX_ARG_OPTIONAL),
+      };
+
+  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
+  if (jerry_value_is_exception(rv))
+  {
+    return rv;
+  }
+
+  PinName name = pin < PINS_COUNT ? digitalPinToPinName((pin_size_t)pin) : NC;
+
+  /* pinmap_peripheral and pinmap_function stop the board on a pin without timer */
+  uint32_t tim = name != NC ? pinmap_find_peripheral(name, PinMap_PWM) : (uint32_t)NC;
+  uint32_t channel = tim != (uint32_t)NC ? STM_PIN_CHANNEL(pinmap_find_function(name, PinMap_PWM)) : 0;
+
+  if (channel < 1 || channel > 4)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'pin' must be a PWM pin.");
+  }
+
+  /* CCR1 to CCR4 follow each other */
+  TIM_TypeDef *tim_p = (TIM_TypeDef *)(uintptr_t)tim;
+  volatile uint32_t *ccr_p = &tim_p->CCR1 + (channel - 1);
+
+  if (jerryxx_tim_user(tim_p) == JERRYXX_TIM_ENCODER)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'pin' must not be on the timer of an Encoder.");
+  }
+
+  /* Closing either of two objects on one channel would free it under the other */
+  for (const jerryxx_pwm_t *open_p = jerryxx_pwm_open_list; open_p != NULL; open_p = open_p->next_p)
+  {
+    if (open_p->ccr_p == ccr_p)
+    {
+      return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'pin' must not be on the channel of an open PwmOut.");
+    }
+  }
+
+  if (frequency == 0 || frequency > 1000000)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong option 'frequency' must be between 1 and 1000000.");
+  }
+
+  if (resolution > 16)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong option 'resolution' must be between 0 and 16.");
+  }
+
+  /* The smallest prescaler leaves the largest auto-reload, so the finest duty steps */
+  uint32_t ticks = jerryxx_tim_clock(tim_p) / frequency;
+  uint64_t arr_max = IS_TIM_32B_COUNTER_INSTANCE(tim_p) ? UINT32_MAX : UINT16_MAX;
+  uint32_t psc = (uint32_t)((ticks - 1) / (arr_max + 1));
+  uint32_t arr = (ticks + (psc + 1) / 2) / (psc + 1) - 1;
+
+  if ((1ULL << resolution) > (uint64_t)arr + 1)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong option 'resolution' must not have more steps than the period at this 'frequency'.");
+  }
+
+  /* The channels of a timer share its period: another one would change the open channels */
+  const jerryxx_pwm_t *shared_p = jerryxx_pwm_find_timer(tim_p);
+
+  if (shared_p != NULL && (shared_p->psc != psc || shared_p->arr != arr))
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong option 'frequency' must be the one of the open PwmOut on the same timer.");
+  }
+
+  jerryxx_pwm_t *pwm_p = new jerryxx_pwm_t;
+  pwm_p->psc = psc;
+  pwm_p->arr = arr;
+  pwm_p->scale = resolution != 0 ? 1.0f / (float)((1UL << resolution) - 1) : 1.0f;
+  pwm_p->pwm_p = new mbed::PwmOut(name);
+  pwm_p->pwm_p->write(0.0f);
+
+  /* mbed counts microseconds: the update event loads the prescaler and the auto-reload at once */
+  tim_p->PSC = psc;
+  tim_p->ARR = arr;
+  tim_p->EGR = TIM_EGR_UG;
+
+  pwm_p->tim_p = tim_p;
+  pwm_p->ccr_p = ccr_p;
+  pwm_p->next_p = jerryxx_pwm_open_list;
+  jerryxx_pwm_open_list = pwm_p;
+  jerryxx_tim_set_user(tim_p, JERRYXX_TIM_PWM);
+  jerry_object_set_native_ptr(call_info_p->this_value, &jerryxx_pwm_info, pwm_p);
+
+  return jerry_undefined();
+} /* js_pwm_out */
+
+/**
+ * Arduino: PwmOut.prototype.duty
+ */
+JERRYXX_DECLARE_FUNCTION(pwm_out_duty)
+{
+  JERRYXX_ON_ARGS_COUNT_THROW_ERROR_SYNTAX(args_cnt > 1, "Wrong arguments count");
+
+  JERRYXX_GET_NATIVE_THIS_OR_THROW_ERROR_TYPE(jerryxx_pwm_t, pwm_p, jerryxx_pwm_info, "Wrong 'this' must be a PwmOut.");
+  JERRYXX_ON_TYPE_CHECK_THROW_ERROR_TYPE(pwm_p->pwm_p == NULL, "Wrong 'this' is a closed PwmOut.");
+
+  /* Without argument, read the duty back */
+  if (args_cnt == 0)
+  {
+    return jerry_number(jerryxx_pwm_read(pwm_p));
+  }
+
+  JERRYXX_ON_TYPE_CHECK_THROW_ERROR_TYPE(!jerry_value_is_number(args_p[0]), "Wrong argument 'duty' must be a number.");
+
+  jerryxx_pwm_write(pwm_p, jerry_value_as_number(args_p[0]));
+
+  return jerry_undefined();
+} /* js_pwm_out_duty */
+
+/**
+ * Arduino: PwmOut.prototype.close
+ */
+JERRYXX_DECLARE_FUNCTION(pwm_out_close)
+{
+  JERRYX_UNUSED(args_p);
+  JERRYXX_ON_ARGS_COUNT_THROW_ERROR_SYNTAX(args_cnt != 0, "Wrong arguments count");
+
+  JERRYXX_GET_NATIVE_THIS_OR_THROW_ERROR_TYPE(jerryxx_pwm_t, pwm_p, jerryxx_pwm_info, "Wrong 'this' must be a PwmOut.");
+  JERRYXX_ON_TYPE_CHECK_THROW_ERROR_TYPE(pwm_p->pwm_p == NULL, "Wrong 'this' is a closed PwmOut.");
+
+  jerryxx_pwm_close(pwm_p);
+
+  return jerry_undefined();
+} /* js_pwm_out_close */
+
+/**
+ * Arduino: PwmOut.prototype.frequency
+ */
+JERRYXX_DECLARE_FUNCTION(pwm_out_frequency)
+{
+  JERRYX_UNUSED(args_p);
+  JERRYX_UNUSED(args_cnt);
+
+  JERRYXX_GET_NATIVE_THIS_OR_THROW_ERROR_TYPE(jerryxx_pwm_t, pwm_p, jerryxx_pwm_info, "Wrong 'this' must be a PwmOut.");
+
+  /* The period is a whole number of timer clock ticks */
+  return jerry_number((double)jerryxx_tim_clock(pwm_p->tim_p) / ((double)(pwm_p->psc + 1) * (pwm_p->arr + 1)));
+} /* js_pwm_out_frequency */
 
 /**
- * Arduino: pinMode
+ * Arduino: PwmGroup
  */
-JERRYXX_DECLARE_FUNCTION(pin_mode)
+JERRYXX_DECLARE_FUNCTION(pwm_group)
 {
-  JERRYX_UNUSED(call_info_p);
-  uint32_t pin = 0;
-  uint32_t mode = 0;
+  if (jerry_value_is_undefined(call_info_p->new_target))
+  {
+    return jerry_throw_sz(JERRY_ERROR_TYPE, "Constructor PwmGroup requires 'new'.");
+  }
 
-  const jerryx_arg_t mapping[] =
-      {
-          jerryx_arg_uint32(&pin, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
-          jerryx_arg_uint32(&mode, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
-      };
+  JERRYXX_ON_ARGS_COUNT_THROW_ERROR_SYNTAX(args_cnt != 1, "Wrong arguments count");
+  JERRYXX_ON_TYPE_CHECK_THROW_ERROR_TYPE(!jerry_value_is_array(args_p[0]), "Wrong argument 'channels' must be an array of PwmOut.");
 
-  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
-  if (jerry_value_is_exception(rv))
+  jerry_length_t count = jerry_array_length(args_p[0]);
+
+  if (count == 0)
   {
-    return rv;
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'channels' must not be empty.");
   }
 
-  if (mode != INPUT && mode != OUTPUT && mode != INPUT_PULLUP && mode != INPUT_PULLDOWN)
+  /* A copy of the array keeps the channels alive, whatever happens to the argument */
+  jerry_value_t channels = jerry_array(count);
+  jerryxx_pwm_group_t *group_p = new jerryxx_pwm_group_t;
+  group_p->count = count;
+  group_p->pwms_p = new jerryxx_pwm_t *[count];
+
+  for (jerry_length_t idx = 0; idx < count; idx++)
   {
-    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'mode' must be INPUT, OUTPUT, INPUT_PULLUP or INPUT_PULLDOWN.");
+    jerry_value_t item = jerry_object_get_index(args_p[0], idx);
+    group_p->pwms_p[idx] = (jerryxx_pwm_t *)jerry_object_get_native_ptr(item, &jerryxx_pwm_info);
+    jerry_value_free(jerry_object_set_index(channels, idx, item));
+    jerry_value_free(item);
+
+    if (group_p->pwms_p[idx] == NULL)
+    {
+      jerry_value_free(channels);
+      delete[] group_p->pwms_p;
+      delete group_p;
+      return jerry_throw_sz(JERRY_ERROR_TYPE, "Wrong argument 'channels' must be an array of PwmOut.");
+    }
   }
 
-  pinMode(pin, mode);
+  jerry_value_t key = jerry_string_sz("channels");
+  jerry_object_set_internal(call_info_p->this_value, key, channels);
+  jerry_value_free(key);
+  jerry_value_free(channels);
+
+  jerry_object_set_native_ptr(call_info_p->this_value, &jerryxx_pwm_group_info, group_p);
 
   return jerry_undefined();
-} /* js_pin_mode */
+} /* js_pwm_group */
 
 /**
- * Arduino: digitalWrite
+ * Arduino: PwmGroup.prototype.update
  */
-JERRYXX_DECLARE_FUNCTION(digital_write)
+JERRYXX_DECLARE_FUNCTION(pwm_group_update)
 {
-  JERRYX_UNUSED(call_info_p);
-  uint32_t pin = 0;
-  uint32_t value = 0;
+  JERRYXX_ON_ARGS_COUNT_THROW_ERROR_SYNTAX(args_cnt != 1, "Wrong arguments count");
 
-  const jerryx_arg_t mapping[] =
-      {
-          jerryx_arg_uint32(&pin, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
-          jerryx_arg_uint32(&value, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_COERCE, JERRYX_ARG_REQUIRED),
-      };
+  JERRYXX_GET_NATIVE_THIS_OR_THROW_ERROR_TYPE(jerryxx_pwm_group_t, group_p, jerryxx_pwm_group_info, "Wrong 'this' must be a PwmGroup.");
 
-  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
-  if (jerry_value_is_exception(rv))
+  JERRYXX_ON_TYPE_CHECK_THROW_ERROR_TYPE(!jerry_value_is_typedarray(args_p[0]) || jerry_typedarray_type(args_p[0]) != JERRY_TYPEDARRAY_FLOAT32,
+                                         "Wrong argument 'duties' must be a Float32Array.");
+
+  jerry_length_t count = 0;
+  const float *duties_p = (const float *)jerryxx_typedarray_data(args_p[0], JERRY_TYPEDARRAY_FLOAT32, &count);
+
+  if (duties_p == NULL || count != group_p->count)
   {
-    return rv;
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'duties' must have one duty per channel.");
   }
 
-  if (value != HIGH && value != LOW)
+  for (uint32_t idx = 0; idx < group_p->count; idx++)
   {
-    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'value' must be HIGH or LOW.");
+    if (group_p->pwms_p[idx]->pwm_p == NULL)
+    {
+      return jerry_throw_sz(JERRY_ERROR_TYPE, "Wrong 'this' must not have closed channels.");
+    }
   }
 
-  digitalWrite(pin, value);
-
-  return jerry_undefined();
-} /* js_digital_write */
-
-/**
- * Arduino: digitalRead
- */
-JERRYXX_DECLARE_FUNCTION(digital_read)
-{
-  JERRYX_UNUSED(call_info_p);
-  uint32_t pin = 0;
-
-  const jerryx_arg_t mapping[] =
-      {
-          jerryx_arg_uint32(&pin, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
-      };
-
-  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
-  if (jerry_value_is_exception(rv))
+  /* The compare registers are preloaded: written together, the duties of a timer start on the same period */
+  core_util_critical_section_enter();
+  for (uint32_t idx = 0; idx < group_p->count; idx++)
   {
-    return rv;
+    jerryxx_pwm_write(group_p->pwms_p[idx], duties_p[idx]);
   }
+  core_util_critical_section_exit();
 
-  return jerry_number(digitalRead(pin));
-} /* js_digital_read */
+  return jerry_undefined();
+} /* js_pwm_group_update */
 
 /**
- * Arduino: delay
+ * Arduino: analogReadResolution
  */
-JERRYXX_DECLARE_FUNCTION(delay)
+JERRYXX_DECLARE_FUNCTION(analog_read_resolution)
 {
   JERRYX_UNUSED(call_info_p);
-  uint32_t value = 0;
+  uint32_t bits = 0;
 
   const jerryx_arg_t mapping[] =
       {
-          jerryx_arg_uint32(&value, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+          jerryx_arg_uint32(&bits, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
       };
 
   const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
@@ -863,22 +7310,22 @@ JERRYXX_DECLARE_FUNCTION(delay)
     return rv;
   }
 
-  delay(value);
+  analogReadResolution(bits);
 
   return jerry_undefined();
-} /* js_delay */
+} /* js_analog_read_resolution */
 
 /**
- * Arduino: delayMicroseconds
+ * Arduino: analogWriteResolution
  */
-JERRYXX_DECLARE_FUNCTION(delay_microseconds)
+JERRYXX_DECLARE_FUNCTION(analog_write_resolution)
 {
   JERRYX_UNUSED(call_info_p);
-  uint32_t value = 0;
+  uint32_t bits = 0;
 
   const jerryx_arg_t mapping[] =
       {
-          jerryx_arg_uint32(&value, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+          jerryx_arg_uint32(&bits, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
       };
 
   const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
@@ -887,46 +7334,75 @@ JERRYXX_DECLARE_FUNCTION(delay_microseconds)
     return rv;
   }
 
-  delayMicroseconds(value);
+  analogWriteResolution(bits);
 
   return jerry_undefined();
-} /* js_delay_microseconds */
+} /* js_analog_write_resolution */
 
 /**
- * Arduino: micros
+ * Arduino: interrupts
  */
-JERRYXX_DECLARE_FUNCTION(micros)
+JERRYXX_DECLARE_FUNCTION(interrupts)
 {
   JERRYX_UNUSED(call_info_p);
   JERRYX_UNUSED(args_p);
   JERRYXX_ON_ARGS_COUNT_THROW_ERROR_SYNTAX(args_cnt != 0, "Wrong arguments count");
 
-  return jerry_number(micros());
-} /* js_micros */
+  interrupts();
+
+  return jerry_undefined();
+} /* js_interrupts */
 
 /**
- * Arduino: millis
+ * Arduino: noInterrupts
  */
-JERRYXX_DECLARE_FUNCTION(millis)
+JERRYXX_DECLARE_FUNCTION(no_interrupts)
 {
   JERRYX_UNUSED(call_info_p);
   JERRYX_UNUSED(args_p);
   JERRYXX_ON_ARGS_COUNT_THROW_ERROR_SYNTAX(args_cnt != 0, "Wrong arguments count");
 
-  return jerry_number(millis());
-} /* js_millis */
+  noInterrupts();
+
+  return jerry_undefined();
+} /* js_no_interrupts */
 
 /**
- * Arduino: randomSeed
+ * Arduino: attachInterrupt
  */
-JERRYXX_DECLARE_FUNCTION(random_seed)
+JERRYXX_DECLARE_FUNCTION(attach_interrupt)
 {
   JERRYX_UNUSED(call_info_p);
-  uint32_t seed = 0;
+  uint32_t pin = 0;
+  jerry_value_t callback_fn = 0;
+  uint32_t mode = 0;
+  uint32_t batch = 0;
+  uint32_t window_ms = 0;
+  uint32_t stable_us = 0;
+  uint32_t min_pulse_us = 0;
+
+  const char *options_names[] = {"batch", "windowMs", "stableUs", "minPulseUs"};
+  const jerryx_arg_t options_mapping[] =
+      {
+          jerryx_arg_uint32(&batch, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_OPTIONAL),
+          jerryx_arg_uint32(&window_ms, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_OPTIONAL),
+          jerryx_arg_uint32(&stable_us, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_OPTIONAL),
+          jerryx_arg_uint32(&min_pulse_us, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_OPTIONAL),
+      };
+  const jerryx_arg_object_props_t options =
+      {
+          (const jerry_char_t **)options_names,
+          JERRYXX_ARRAY_SIZE(options_names),
+          options_mapping,
+          JERRYXX_ARRAY_SIZE(options_mapping),
+      };
 
   const jerryx_arg_t mapping[] =
       {
-          jerryx_arg_uint32(&seed, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+          jerryx_arg_uint32(&pin, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+          jerryx_arg_function(&callback_fn, JERRYX_ARG_REQUIRED),
+          jerryx_arg_uint32(&mode, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+          jerryx_arg_object_properties(&options, JERRYX_ARG_OPTIONAL),
       };
 
   const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
@@ -935,24 +7411,54 @@ JERRYXX_DECLARE_FUNCTION(random_seed)
     return rv;
   }
 
-  randomSeed(seed);
+  if (pin >= PINS_COUNT)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'pin' must be a pin.");
+  }
+
+  if (batch > JERRYXX_INTERRUPT_BATCH_MAX)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong option 'batch' must be between 0 and JERRYXX_INTERRUPT_BATCH_MAX.");
+  }
+
+  if (window_ms != 0 && batch == 0)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong option 'windowMs' requires the option 'batch'.");
+  }
+
+  if (window_ms > UINT32_MAX / 1000)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong option 'windowMs' is too long.");
+  }
+
+  if (stable_us > INT32_MAX || min_pulse_us > INT32_MAX)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong option 'stableUs' or 'minPulseUs' is too long.");
+  }
+
+  /* A new handler of the same pin replaces the previous one */
+  if (!(jerryxx_interrupt_attached[pin / 32] & (1UL << (pin % 32))) && !jerryxx_exti_is_free(pin))
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'pin' shares its interrupt line with a pin in use.");
+  }
+
+  jerryxx_interrupt_options_t interrupt_options = {batch, window_ms * 1000, stable_us, min_pulse_us};
+  jerryxx_interrupt_attach(pin, callback_fn, mode, &interrupt_options);
 
   return jerry_undefined();
-} /* js_random_seed */
+} /* js_attach_interrupt */
 
 /**
- * Arduino: random
+ * Arduino: detachInterrupt
  */
-JERRYXX_DECLARE_FUNCTION(random)
+JERRYXX_DECLARE_FUNCTION(detach_interrupt)
 {
   JERRYX_UNUSED(call_info_p);
-  uint32_t a = 0;
-  uint32_t b = 0;
+  uint32_t pin = 0;
 
   const jerryx_arg_t mapping[] =
       {
-          jerryx_arg_uint32(&a, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
-          jerryx_arg_uint32(&b, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_OPTIONAL),
+          jerryx_arg_uint32(&pin, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
       };
 
   const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
@@ -961,29 +7467,25 @@ JERRYXX_DECLARE_FUNCTION(random)
     return rv;
   }
 
-  if (args_cnt == 1)
-  {
-    return jerry_number(random(a));
-  }
-  else if (args_cnt == 2)
+  if (pin < PINS_COUNT)
   {
-    return jerry_number(random(a, b));
+    jerryxx_interrupt_detach(pin);
   }
 
-  return jerry_number(0);
-} /* js_random */
+  return jerry_undefined();
+} /* js_detach_interrupt */
 
 /**
- * Arduino: analogRead
+ * Arduino: getInterruptStats
  */
-JERRYXX_DECLARE_FUNCTION(analog_read)
+JERRYXX_DECLARE_FUNCTION(get_interrupt_stats)
 {
   JERRYX_UNUSED(call_info_p);
-  uint32_t pin = 0;
+  uint32_t pin = UINT32_MAX;
 
   const jerryx_arg_t mapping[] =
       {
-          jerryx_arg_uint32(&pin, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+          jerryx_arg_uint32(&pin, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_OPTIONAL),
       };
 
   const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
@@ -992,46 +7494,103 @@ JERRYXX_DECLARE_FUNCTION(analog_read)
     return rv;
   }
 
-  return jerry_number(analogRead(pin));
-} /* js_analog_read */
+  jerry_value_t stats = jerry_object();
+
+  if (pin == UINT32_MAX)
+  {
+    jerryxx_interrupt_stats_t interrupt_stats;
+    jerryxx_get_interrupt_stats(&interrupt_stats);
+
+    jerryxx_object_set_number(stats, "pending", interrupt_stats.pending);
+    jerryxx_object_set_number(stats, "queued", interrupt_stats.queued);
+    jerryxx_object_set_number(stats, "dispatched", interrupt_stats.dispatched);
+    jerryxx_object_set_number(stats, "overflows", interrupt_stats.overflows);
+    jerryxx_object_set_number(stats, "glitches", interrupt_stats.glitches);
+    jerryxx_object_set_number(stats, "maxPending", interrupt_stats.max_pending);
+    return stats;
+  }
+
+  if (pin >= PINS_COUNT || !(jerryxx_interrupt_attached[pin / 32] & (1UL << (pin % 32))))
+  {
+    jerry_value_free(stats);
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'pin' must have an interrupt attached");
+  }
+
+  jerryxx_interrupt_t *interrupt_p = &jerryxx_interrupts[pin];
+  jerryxx_object_set_number(stats, "queued", interrupt_p->queued);
+  jerryxx_object_set_number(stats, "dispatched", interrupt_p->dispatched);
+  jerryxx_object_set_number(stats, "overflows", interrupt_p->overflows);
+  jerryxx_object_set_number(stats, "glitches", interrupt_p->glitches);
+
+  if (interrupt_p->batch_p != NULL)
+  {
+    jerryxx_object_set_number(stats, "batches", interrupt_p->batch_p->batches);
+  }
+
+  return stats;
+} /* js_get_interrupt_stats */
 
 /**
- * Arduino: analogWrite
+ * Arduino: getInterruptLatency
  */
-JERRYXX_DECLARE_FUNCTION(analog_write)
+JERRYXX_DECLARE_FUNCTION(get_interrupt_latency)
 {
   JERRYX_UNUSED(call_info_p);
-  uint32_t pin = 0;
-  uint32_t value = 0;
+  JERRYX_UNUSED(args_p);
+  JERRYXX_ON_ARGS_COUNT_THROW_ERROR_SYNTAX(args_cnt != 0, "Wrong arguments count");
 
-  const jerryx_arg_t mapping[] =
-      {
-          jerryx_arg_uint32(&pin, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
-          jerryx_arg_uint32(&value, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
-      };
+  const char *stage_names[JERRYXX_LATENCY_COUNT] = {"dequeue", "start", "callback"};
+  jerryxx_latency_summary_t summaries[JERRYXX_LATENCY_COUNT];
+  jerryxx_get_interrupt_latency(summaries);
 
-  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
-  if (jerry_value_is_exception(rv))
+  jerry_value_t latency = jerry_object();
+
+  for (uint32_t stage = 0; stage < JERRYXX_LATENCY_COUNT; stage++)
   {
-    return rv;
+    jerry_value_t summary = jerry_object();
+    jerryxx_object_set_number(summary, "count", summaries[stage].count);
+    jerryxx_object_set_number(summary, "min", summaries[stage].min);
+    jerryxx_object_set_number(summary, "avg", summaries[stage].avg);
+    jerryxx_object_set_number(summary, "max", summaries[stage].max);
+    jerryxx_object_set_number(summary, "p99", summaries[stage].p99);
+    jerry_value_free(jerry_object_set_sz(latency, stage_names[stage], summary));
+    jerry_value_free(summary);
   }
 
-  analogWrite(pin, value);
+  return latency;
+} /* js_get_interrupt_latency */
+
+/**
+ * Arduino: resetInterruptLatency
+ */
+JERRYXX_DECLARE_FUNCTION(reset_interrupt_latency)
+{
+  JERRYX_UNUSED(call_info_p);
+  JERRYX_UNUSED(args_p);
+  JERRYXX_ON_ARGS_COUNT_THROW_ERROR_SYNTAX(args_cnt != 0, "Wrong arguments count");
+
+  jerryxx_reset_interrupt_latency();
 
   return jerry_undefined();
-} /* js_analog_write */
+} /* js_reset_interrupt_latency */
 
 /**
- * Arduino: analogReadResolution
+ * Arduino: Encoder
  */
-JERRYXX_DECLARE_FUNCTION(analog_read_resolution)
+JERRYXX_DECLARE_FUNCTION(encoder)
 {
-  JERRYX_UNUSED(call_info_p);
-  uint32_t bits = 0;
+  uint32_t pin_a = 0;
+  uint32_t pin_b = 0;
+
+  if (jerry_value_is_undefined(call_info_p->new_target))
+  {
+    return jerry_throw_sz(JERRY_ERROR_TYPE, "Constructor Encoder requires 'new'.");
+  }
 
   const jerryx_arg_t mapping[] =
       {
-          jerryx_arg_uint32(&bits, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+          jerryx_arg_uint32(&pin_a, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+          jerryx_arg_uint32(&pin_b, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
       };
 
   const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
@@ -1040,78 +7599,140 @@ JERRYXX_DECLARE_FUNCTION(analog_read_resolution)
     return rv;
   }
 
-  analogReadResolution(bits);
+  jerryxx_gpio_t gpio;
+
+  if (!jerryxx_gpio_from_pin(pin_a, &gpio))
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'pinA' must be a pin.");
+  }
+
+  if (!jerryxx_gpio_from_pin(pin_b, &gpio) || pin_b == pin_a)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'pinB' must be a pin other than 'pinA'.");
+  }
+
+  jerryxx_encoder_t *encoder_p = new jerryxx_encoder_t;
+
+  if (!jerryxx_encoder_init(encoder_p, pin_a, pin_b))
+  {
+    delete encoder_p;
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong arguments 'pinA' and 'pinB' must use two free interrupt lines.");
+  }
+
+  jerry_object_set_native_ptr(call_info_p->this_value, &jerryxx_encoder_info, encoder_p);
+
+  return jerry_undefined();
+} /* js_encoder */
+
+/**
+ * Arduino: Encoder.prototype.reset
+ */
+JERRYXX_DECLARE_FUNCTION(encoder_reset)
+{
+  JERRYX_UNUSED(args_p);
+  JERRYXX_ON_ARGS_COUNT_THROW_ERROR_SYNTAX(args_cnt != 0, "Wrong arguments count");
+
+  JERRYXX_GET_NATIVE_THIS_OR_THROW_ERROR_TYPE(jerryxx_encoder_t, encoder_p, jerryxx_encoder_info, "Wrong 'this' must be an Encoder.");
+
+  jerryxx_encoder_reset(encoder_p);
+  return jerry_undefined();
+} /* js_encoder_reset */
+
+/**
+ * Arduino: Encoder.prototype.close
+ */
+JERRYXX_DECLARE_FUNCTION(encoder_close)
+{
+  JERRYX_UNUSED(args_p);
+  JERRYXX_ON_ARGS_COUNT_THROW_ERROR_SYNTAX(args_cnt != 0, "Wrong arguments count");
+
+  JERRYXX_GET_NATIVE_THIS_OR_THROW_ERROR_TYPE(jerryxx_encoder_t, encoder_p, jerryxx_encoder_info, "Wrong 'this' must be an Encoder.");
+
+  jerryxx_encoder_release(encoder_p);
+  return jerry_undefined();
+} /* js_encoder_close */
+
+/**
+ * Arduino: Encoder.prototype.position
+ */
+JERRYXX_DECLARE_FUNCTION(encoder_position)
+{
+  JERRYX_UNUSED(args_p);
+  JERRYX_UNUSED(args_cnt);
+
+  JERRYXX_GET_NATIVE_THIS_OR_THROW_ERROR_TYPE(jerryxx_encoder_t, encoder_p, jerryxx_encoder_info, "Wrong 'this' must be an Encoder.");
 
-  return jerry_undefined();
-} /* js_analog_read_resolution */
+  return jerry_number((double)jerryxx_encoder_position(encoder_p));
+} /* js_encoder_position */
 
 /**
- * Arduino: analogWriteResolution
+ * Arduino: Encoder.prototype.velocity
  */
-JERRYXX_DECLARE_FUNCTION(analog_write_resolution)
+JERRYXX_DECLARE_FUNCTION(encoder_velocity)
 {
-  JERRYX_UNUSED(call_info_p);
-  uint32_t bits = 0;
+  JERRYX_UNUSED(args_p);
+  JERRYX_UNUSED(args_cnt);
 
-  const jerryx_arg_t mapping[] =
-      {
-          jerryx_arg_uint32(&bits, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
-      };
+  JERRYXX_GET_NATIVE_THIS_OR_THROW_ERROR_TYPE(jerryxx_encoder_t, encoder_p, jerryxx_encoder_info, "Wrong 'this' must be an Encoder.");
 
-  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
-  if (jerry_value_is_exception(rv))
+  if (!encoder_p->active)
   {
-    return rv;
+    return jerry_number(0);
   }
 
-  analogWriteResolution(bits);
+  return jerry_number((double)encoder_p->last_delta * 1000000.0 / JERRYXX_ENCODER_SAMPLE_US);
+} /* js_encoder_velocity */
 
-  return jerry_undefined();
-} /* js_analog_write_resolution */
+/**
+ * Arduino: Encoder.prototype.overflows
+ */
+JERRYXX_DECLARE_FUNCTION(encoder_overflows)
+{
+  JERRYX_UNUSED(args_p);
+  JERRYX_UNUSED(args_cnt);
+
+  JERRYXX_GET_NATIVE_THIS_OR_THROW_ERROR_TYPE(jerryxx_encoder_t, encoder_p, jerryxx_encoder_info, "Wrong 'this' must be an Encoder.");
+
+  return jerry_number(encoder_p->overflows);
+} /* js_encoder_overflows */
 
 /**
- * Arduino: interrupts
+ * Arduino: Encoder.prototype.errors
  */
-JERRYXX_DECLARE_FUNCTION(interrupts)
+JERRYXX_DECLARE_FUNCTION(encoder_errors)
 {
-  JERRYX_UNUSED(call_info_p);
   JERRYX_UNUSED(args_p);
-  JERRYXX_ON_ARGS_COUNT_THROW_ERROR_SYNTAX(args_cnt != 0, "Wrong arguments count");
+  JERRYX_UNUSED(args_cnt);
 
-  interrupts();
+  JERRYXX_GET_NATIVE_THIS_OR_THROW_ERROR_TYPE(jerryxx_encoder_t, encoder_p, jerryxx_encoder_info, "Wrong 'this' must be an Encoder.");
 
-  return jerry_undefined();
-} /* js_interrupts */
+  return jerry_number(encoder_p->errors);
+} /* js_encoder_errors */
 
 /**
- * Arduino: noInterrupts
+ * Arduino: Encoder.prototype.hardware
  */
-JERRYXX_DECLARE_FUNCTION(no_interrupts)
+JERRYXX_DECLARE_FUNCTION(encoder_hardware)
 {
-  JERRYX_UNUSED(call_info_p);
   JERRYX_UNUSED(args_p);
-  JERRYXX_ON_ARGS_COUNT_THROW_ERROR_SYNTAX(args_cnt != 0, "Wrong arguments count");
+  JERRYX_UNUSED(args_cnt);
 
-  noInterrupts();
+  JERRYXX_GET_NATIVE_THIS_OR_THROW_ERROR_TYPE(jerryxx_encoder_t, encoder_p, jerryxx_encoder_info, "Wrong 'this' must be an Encoder.");
 
-  return jerry_undefined();
-} /* js_no_interrupts */
+  return jerry_boolean(encoder_p->tim_p != NULL);
+} /* js_encoder_hardware */
 
 /**
- * Arduino: attachInterrupt
+ * Arduino: noTone
  */
-JERRYXX_DECLARE_FUNCTION(attach_interrupt)
+JERRYXX_DECLARE_FUNCTION(no_tone)
 {
   JERRYX_UNUSED(call_info_p);
   uint32_t pin = 0;
-  jerry_value_t callback_fn = 0;
-  uint32_t mode = 0;
 
   const jerryx_arg_t mapping[] =
       {
           jerryx_arg_uint32(&pin, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
-          jerryx_arg_function(&callback_fn, JERRYX_ARG_REQUIRED),
-          jerryx_arg_uint32(&mode, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
       };
 
   const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
@@ -1120,29 +7741,30 @@ JERRYXX_DECLARE_FUNCTION(attach_interrupt)
     return rv;
   }
 
-  auto func = [](void *callback_fn) -> void
+  /* Also ends a melody of playSequence on the pin */
+  if (!jerryxx_sequence_stop(pin))
   {
-    jerry_value_t global_obj_val = jerry_current_realm();
-    jerry_value_free(jerry_call((jerry_value_t)callback_fn, global_obj_val, NULL, 0));
-    jerry_value_free(global_obj_val);
-  };
-
-  attachInterruptParam((pin_size_t)pin, (voidFuncPtrParam)func, (PinStatus)mode, (void *)callback_fn);
+    noTone(pin);
+  }
 
   return jerry_undefined();
-} /* js_attach_interrupt */
+} /* js_no_tone */
 
 /**
- * Arduino: detachInterrupt
+ * Arduino: pulseIn
  */
-JERRYXX_DECLARE_FUNCTION(detach_interrupt)
+JERRYXX_DECLARE_FUNCTION(pulse_in)
 {
   JERRYX_UNUSED(call_info_p);
   uint32_t pin = 0;
+  uint32_t value = 0;
+  uint32_t timeout = 1000000;
 
   const jerryx_arg_t mapping[] =
       {
           jerryx_arg_uint32(&pin, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+          jerryx_arg_uint32(&value, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_COERCE, JERRYX_ARG_REQUIRED),
+          jerryx_arg_uint32(&timeout, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_OPTIONAL),
       };
 
   const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
@@ -1151,22 +7773,24 @@ JERRYXX_DECLARE_FUNCTION(detach_interrupt)
     return rv;
   }
 
-  detachInterrupt(pin);
-
-  return jerry_undefined();
-} /* js_detach_interrupt */
+  return jerry_number(pulseIn(pin, value, timeout));
+} /* js_pulse_in */
 
 /**
- * Arduino: noTone
+ * Arduino: pulseInLong
  */
-JERRYXX_DECLARE_FUNCTION(no_tone)
+JERRYXX_DECLARE_FUNCTION(pulse_in_long)
 {
   JERRYX_UNUSED(call_info_p);
   uint32_t pin = 0;
+  uint32_t value = 0;
+  uint32_t timeout = 1000000;
 
   const jerryx_arg_t mapping[] =
       {
           jerryx_arg_uint32(&pin, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+          jerryx_arg_uint32(&value, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_COERCE, JERRYX_ARG_REQUIRED),
+          jerryx_arg_uint32(&timeout, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_OPTIONAL),
       };
 
   const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
@@ -1175,15 +7799,13 @@ JERRYXX_DECLARE_FUNCTION(no_tone)
     return rv;
   }
 
-  noTone(pin);
-
-  return jerry_undefined();
-} /* js_no_tone */
+  return jerry_number(pulseInLong(pin, value, timeout));
+} /* js_pulse_in_long */
 
 /**
- * Arduino: pulseIn
+ * Arduino: pulseInAsync
  */
-JERRYXX_DECLARE_FUNCTION(pulse_in)
+JERRYXX_DECLARE_FUNCTION(pulse_in_async)
 {
   JERRYX_UNUSED(call_info_p);
   uint32_t pin = 0;
@@ -1203,24 +7825,52 @@ JERRYXX_DECLARE_FUNCTION(pulse_in)
     return rv;
   }
 
-  return jerry_number(pulseIn(pin, value, timeout));
-} /* js_pulse_in */
+  jerryxx_gpio_t gpio;
+
+  if (!jerryxx_gpio_from_pin(pin, &gpio))
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'pin' must be a pin.");
+  }
+
+  if (timeout == 0 || timeout > INT32_MAX)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'timeout' must be between 1 and 2147483647.");
+  }
+
+  /* Also rejects a pin already measured */
+  if (!jerryxx_exti_is_free(pin))
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'pin' shares its interrupt line with a pin in use.");
+  }
+
+  jerry_value_t promise = jerry_promise();
+
+  if (jerryxx_pulse_start(promise, pin, value != LOW ? HIGH : LOW, timeout) == NULL)
+  {
+    jerry_value_free(promise);
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "No pulse slot free found.");
+  }
+
+  return promise;
+} /* js_pulse_in_async */
 
 /**
- * Arduino: pulseInLong
+ * Arduino: FrequencyCounter
  */
-JERRYXX_DECLARE_FUNCTION(pulse_in_long)
+JERRYXX_DECLARE_FUNCTION(frequency_counter)
 {
-  JERRYX_UNUSED(call_info_p);
   uint32_t pin = 0;
-  uint32_t value = 0;
-  uint32_t timeout = 1000000;
+  uint32_t gate_ms = 0;
+
+  if (jerry_value_is_undefined(call_info_p->new_target))
+  {
+    return jerry_throw_sz(JERRY_ERROR_TYPE, "Constructor FrequencyCounter requires 'new'.");
+  }
 
   const jerryx_arg_t mapping[] =
       {
           jerryx_arg_uint32(&pin, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
-          jerryx_arg_uint32(&value, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_COERCE, JERRYX_ARG_REQUIRED),
-          jerryx_arg_uint32(&timeout, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_OPTIONAL),
+          jerryx_arg_uint32(&gate_ms, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
       };
 
   const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
@@ -1229,8 +7879,148 @@ JERRYXX_DECLARE_FUNCTION(pulse_in_long)
     return rv;
   }
 
-  return jerry_number(pulseInLong(pin, value, timeout));
-} /* js_pulse_in_long */
+  jerryxx_gpio_t gpio;
+
+  if (!jerryxx_gpio_from_pin(pin, &gpio))
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'pin' must be a pin.");
+  }
+
+  if (gate_ms == 0 || gate_ms > INT32_MAX / 1000)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'gateMs' must be between 1 and 2147483.");
+  }
+
+  if (!jerryxx_exti_is_free(pin))
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'pin' shares its interrupt line with a pin in use.");
+  }
+
+  jerryxx_frequency_t *counter_p = new jerryxx_frequency_t;
+  jerryxx_frequency_init(counter_p, pin, gate_ms * 1000);
+  jerry_object_set_native_ptr(call_info_p->this_value, &jerryxx_frequency_info, counter_p);
+
+  return jerry_undefined();
+} /* js_frequency_counter */
+
+/**
+ * Arduino: FrequencyCounter.prototype.reset
+ */
+JERRYXX_DECLARE_FUNCTION(frequency_counter_reset)
+{
+  JERRYX_UNUSED(args_p);
+  JERRYXX_ON_ARGS_COUNT_THROW_ERROR_SYNTAX(args_cnt != 0, "Wrong arguments count");
+
+  JERRYXX_GET_NATIVE_THIS_OR_THROW_ERROR_TYPE(jerryxx_frequency_t, counter_p, jerryxx_frequency_info, "Wrong 'this' must be a FrequencyCounter.");
+
+  jerryxx_frequency_reset(counter_p);
+  return jerry_undefined();
+} /* js_frequency_counter_reset */
+
+/**
+ * Arduino: FrequencyCounter.prototype.close
+ */
+JERRYXX_DECLARE_FUNCTION(frequency_counter_close)
+{
+  JERRYX_UNUSED(args_p);
+  JERRYXX_ON_ARGS_COUNT_THROW_ERROR_SYNTAX(args_cnt != 0, "Wrong arguments count");
+
+  JERRYXX_GET_NATIVE_THIS_OR_THROW_ERROR_TYPE(jerryxx_frequency_t, counter_p, jerryxx_frequency_info, "Wrong 'this' must be a FrequencyCounter.");
+
+  jerryxx_frequency_release(counter_p);
+  return jerry_undefined();
+} /* js_frequency_counter_close */
+
+/**
+ * Arduino: FrequencyCounter.prototype.frequency
+ */
+JERRYXX_DECLARE_FUNCTION(frequency_counter_frequency)
+{
+  JERRYX_UNUSED(args_p);
+  JERRYX_UNUSED(args_cnt);
+
+  JERRYXX_GET_NATIVE_THIS_OR_THROW_ERROR_TYPE(jerryxx_frequency_t, counter_p, jerryxx_frequency_info, "Wrong 'this' must be a FrequencyCounter.");
+
+  return jerry_number(counter_p->frequency);
+} /* js_frequency_counter_frequency */
+
+/**
+ * Arduino: FrequencyCounter.prototype.period
+ */
+JERRYXX_DECLARE_FUNCTION(frequency_counter_period)
+{
+  JERRYX_UNUSED(args_p);
+  JERRYX_UNUSED(args_cnt);
+
+  JERRYXX_GET_NATIVE_THIS_OR_THROW_ERROR_TYPE(jerryxx_frequency_t, counter_p, jerryxx_frequency_info, "Wrong 'this' must be a FrequencyCounter.");
+
+  return jerry_number(counter_p->period);
+} /* js_frequency_counter_period */
+
+/**
+ * Arduino: FrequencyCounter.prototype.duty
+ */
+JERRYXX_DECLARE_FUNCTION(frequency_counter_duty)
+{
+  JERRYX_UNUSED(args_p);
+  JERRYX_UNUSED(args_cnt);
+
+  JERRYXX_GET_NATIVE_THIS_OR_THROW_ERROR_TYPE(jerryxx_frequency_t, counter_p, jerryxx_frequency_info, "Wrong 'this' must be a FrequencyCounter.");
+
+  return jerry_number(counter_p->duty);
+} /* js_frequency_counter_duty */
+
+/**
+ * Arduino: FrequencyCounter.prototype.minFrequency
+ */
+JERRYXX_DECLARE_FUNCTION(frequency_counter_min_frequency)
+{
+  JERRYX_UNUSED(args_p);
+  JERRYX_UNUSED(args_cnt);
+
+  JERRYXX_GET_NATIVE_THIS_OR_THROW_ERROR_TYPE(jerryxx_frequency_t, counter_p, jerryxx_frequency_info, "Wrong 'this' must be a FrequencyCounter.");
+
+  return jerry_number(counter_p->min_frequency);
+} /* js_frequency_counter_min_frequency */
+
+/**
+ * Arduino: FrequencyCounter.prototype.maxFrequency
+ */
+JERRYXX_DECLARE_FUNCTION(frequency_counter_max_frequency)
+{
+  JERRYX_UNUSED(args_p);
+  JERRYX_UNUSED(args_cnt);
+
+  JERRYXX_GET_NATIVE_THIS_OR_THROW_ERROR_TYPE(jerryxx_frequency_t, counter_p, jerryxx_frequency_info, "Wrong 'this' must be a FrequencyCounter.");
+
+  return jerry_number(counter_p->max_frequency);
+} /* js_frequency_counter_max_frequency */
+
+/**
+ * Arduino: FrequencyCounter.prototype.gates
+ */
+JERRYXX_DECLARE_FUNCTION(frequency_counter_gates)
+{
+  JERRYX_UNUSED(args_p);
+  JERRYX_UNUSED(args_cnt);
+
+  JERRYXX_GET_NATIVE_THIS_OR_THROW_ERROR_TYPE(jerryxx_frequency_t, counter_p, jerryxx_frequency_info, "Wrong 'this' must be a FrequencyCounter.");
+
+  return jerry_number(counter_p->gates);
+} /* js_frequency_counter_gates */
+
+/**
+ * Arduino: FrequencyCounter.prototype.edges
+ */
+JERRYXX_DECLARE_FUNCTION(frequency_counter_edges)
+{
+  JERRYX_UNUSED(args_p);
+  JERRYX_UNUSED(args_cnt);
+
+  JERRYXX_GET_NATIVE_THIS_OR_THROW_ERROR_TYPE(jerryxx_frequency_t, counter_p, jerryxx_frequency_info, "Wrong 'this' must be a FrequencyCounter.");
+
+  return jerry_number(counter_p->edges);
+} /* js_frequency_counter_edges */
 
 /**
  * Arduino: shiftIn
@@ -1242,6 +8032,8 @@ JERRYXX_DECLARE_FUNCTION(shift_in)
   uint32_t clockPin = 0;
   uint32_t bitOrder = 0;
 
+  JERRYXX_ON_ARGS_COUNT_THROW_ERROR_SYNTAX(args_cnt > 4, "Wrong arguments count");
+
   const jerryx_arg_t mapping[] =
       {
           jerryx_arg_uint32(&dataPin, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
@@ -1249,7 +8041,7 @@ JERRYXX_DECLARE_FUNCTION(shift_in)
           jerryx_arg_uint32(&bitOrder, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
       };
 
-  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
+  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt < 3 ? args_cnt : 3, mapping, JERRYXX_ARRAY_SIZE(mapping));
   if (jerry_value_is_exception(rv))
   {
     return rv;
@@ -1260,7 +8052,31 @@ JERRYXX_DECLARE_FUNCTION(shift_in)
     return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'bitOrder' must be MSBFIRST or LSBFIRST.");
   }
 
-  return jerry_number(shiftIn((pin_size_t)dataPin, (pin_size_t)clockPin, (BitOrder)bitOrder));
+  if (args_cnt < 4)
+  {
+    return jerry_number(shiftIn((pin_size_t)dataPin, (pin_size_t)clockPin, (BitOrder)bitOrder));
+  }
+
+  /* Fill the whole buffer natively */
+  jerry_length_t length = 0;
+  uint8_t *buffer_p = (uint8_t *)jerryxx_typedarray_data(args_p[3], JERRY_TYPEDARRAY_UINT8, &length);
+
+  if (buffer_p == NULL)
+  {
+    return jerry_throw_sz(JERRY_ERROR_TYPE, "Wrong argument 'buffer' must be a Uint8Array.");
+  }
+
+  jerryxx_gpio_t data;
+  jerryxx_gpio_t clock;
+
+  if (!jerryxx_gpio_from_pin(dataPin, &data) || !jerryxx_gpio_from_pin(clockPin, &clock))
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'dataPin' and 'clockPin' must be pins.");
+  }
+
+  jerryxx_shift_in_buffer(&data, &clock, bitOrder, buffer_p, length);
+
+  return jerry_value_copy(args_p[3]);
 } /* js_shift_in */
 
 /**
@@ -1282,7 +8098,10 @@ JERRYXX_DECLARE_FUNCTION(shift_out)
           jerryx_arg_uint32(&value, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
       };
 
-  const jerry_value_t rv = jerryx_arg_transform_args(args_p, args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping));
+  /* A Uint8Array is shifted out whole, natively */
+  bool is_buffer = args_cnt == 4 && jerry_value_is_typedarray(args_p[3]);
+
+  const jerry_value_t rv = jerryx_arg_transform_args(args_p, is_buffer ? 3 : args_cnt, mapping, JERRYXX_ARRAY_SIZE(mapping) - (is_buffer ? 1 : 0));
   if (jerry_value_is_exception(rv))
   {
     return rv;
@@ -1293,7 +8112,29 @@ JERRYXX_DECLARE_FUNCTION(shift_out)
     return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'bitOrder' must be MSBFIRST or LSBFIRST.");
   }
 
-  shiftOut((pin_size_t)dataPin, (pin_size_t)clockPin, (BitOrder)bitOrder, value);
+  if (!is_buffer)
+  {
+    shiftOut((pin_size_t)dataPin, (pin_size_t)clockPin, (BitOrder)bitOrder, value);
+    return jerry_undefined();
+  }
+
+  jerry_length_t length = 0;
+  const uint8_t *buffer_p = (const uint8_t *)jerryxx_typedarray_data(args_p[3], JERRY_TYPEDARRAY_UINT8, &length);
+
+  if (buffer_p == NULL)
+  {
+    return jerry_throw_sz(JERRY_ERROR_TYPE, "Wrong argument 'value' must be a number or a Uint8Array.");
+  }
+
+  jerryxx_gpio_t data;
+  jerryxx_gpio_t clock;
+
+  if (!jerryxx_gpio_from_pin(dataPin, &data) || !jerryxx_gpio_from_pin(clockPin, &clock))
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'dataPin' and 'clockPin' must be pins.");
+  }
+
+  jerryxx_shift_out_buffer(&data, &clock, bitOrder, buffer_p, length);
 
   return jerry_undefined();
 } /* js_shift_out */
@@ -1326,6 +8167,68 @@ JERRYXX_DECLARE_FUNCTION(tone)
   return jerry_undefined();
 } /* js_tone */
 
+/**
+ * Arduino: playSequence
+ */
+JERRYXX_DECLARE_FUNCTION(play_sequence)
+{
+  JERRYX_UNUSED(call_info_p);
+  uint32_t pin = 0;
+
+  JERRYXX_ON_ARGS_COUNT_THROW_ERROR_SYNTAX(args_cnt != 3, "Wrong arguments count");
+
+  const jerryx_arg_t mapping[] =
+      {
+          jerryx_arg_uint32(&pin, JERRYX_ARG_CEIL, JERRYX_ARG_NO_CLAMP, JERRYX_ARG_NO_COERCE, JERRYX_ARG_REQUIRED),
+      };
+
+  const jerry_value_t rv = jerryx_arg_transform_args(args_p, 1, mapping, JERRYXX_ARRAY_SIZE(mapping));
+  if (jerry_value_is_exception(rv))
+  {
+    return rv;
+  }
+
+  jerryxx_gpio_t gpio;
+
+  if (!jerryxx_gpio_from_pin(pin, &gpio))
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'pin' must be a pin.");
+  }
+
+  jerry_length_t length = 0;
+  jerry_length_t durations_length = 0;
+  const uint16_t *frequencies_p = (const uint16_t *)jerryxx_typedarray_data(args_p[1], JERRY_TYPEDARRAY_UINT16, &length);
+  const uint16_t *durations_p = (const uint16_t *)jerryxx_typedarray_data(args_p[2], JERRY_TYPEDARRAY_UINT16, &durations_length);
+
+  if (frequencies_p == NULL || durations_p == NULL)
+  {
+    return jerry_throw_sz(JERRY_ERROR_TYPE, "Wrong argument 'frequencies' and 'durations' must be Uint16Array.");
+  }
+
+  if (length == 0 || length != durations_length)
+  {
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'frequencies' and 'durations' must have the same length, not 0.");
+  }
+
+  for (jerry_length_t idx = 0; idx < length; idx++)
+  {
+    if (frequencies_p[idx] > JERRYXX_SEQUENCE_FREQUENCY_MAX)
+    {
+      return jerry_throw_sz(JERRY_ERROR_RANGE, "Wrong argument 'frequencies' must be at most JERRYXX_SEQUENCE_FREQUENCY_MAX.");
+    }
+  }
+
+  jerry_value_t promise = jerry_promise();
+
+  if (jerryxx_sequence_start(promise, pin, args_p[1], args_p[2], frequencies_p, durations_p, length) == NULL)
+  {
+    jerry_value_free(promise);
+    return jerry_throw_sz(JERRY_ERROR_RANGE, "No sequence slot free found, or the pin already plays a sequence.");
+  }
+
+  return promise;
+} /* js_play_sequence */
+
 /**
  * Arduino: bit
  */
@@ -56,7 +56,140 @@
 
 #define JERRYXX_ARRAY_SIZE(array) ((jerry_length_t) (sizeof (array) / sizeof ((array)[0])))
 
-#define JERRYXX_MAX_THREADS_NUMBER 20
+/**
+ * Number of timers preallocated for setTimeout and setInterval (at most 65536).
+ */
+#ifndef JERRYXX_TIMER_POOL_SIZE
+#define JERRYXX_TIMER_POOL_SIZE 256
+#endif /* !defined (JERRYXX_TIMER_POOL_SIZE) */
+
+/**
+ * Interval at which the REPL polls the serial input while the event loop is idle.
+ */
+#ifndef JERRYXX_LINE_READ_POLL_MS
+#define JERRYXX_LINE_READ_POLL_MS 10
+#endif /* !defined (JERRYXX_LINE_READ_POLL_MS) */
+
+/**
+ * Default number of VM halt checks between two reads of the clock while a callback has a time budget.
+ */
+#ifndef JERRYXX_HALT_CHECK_INTERVAL
+#define JERRYXX_HALT_CHECK_INTERVAL 256
+#endif /* !defined (JERRYXX_HALT_CHECK_INTERVAL) */
+
+/**
+ * Number of pin changes digitalWriteAt can hold.
+ */
+#ifndef JERRYXX_GPIO_ACTION_QUEUE_SIZE
+#define JERRYXX_GPIO_ACTION_QUEUE_SIZE 64
+#endif /* !defined (JERRYXX_GPIO_ACTION_QUEUE_SIZE) */
+
+/**
+ * Pin changes due within this many microseconds are awaited spinning in the timer interrupt.
+ */
+#ifndef JERRYXX_GPIO_ACTION_SPIN_US
+#define JERRYXX_GPIO_ACTION_SPIN_US 20
+#endif /* !defined (JERRYXX_GPIO_ACTION_SPIN_US) */
+
+/**
+ * Number of native tickers setTicker can run at the same time.
+ */
+#ifndef JERRYXX_TICKER_COUNT
+#define JERRYXX_TICKER_COUNT 4
+#endif /* !defined (JERRYXX_TICKER_COUNT) */
+
+/**
+ * Maximum number of samples delivered to a ticker callback.
+ */
+#ifndef JERRYXX_TICKER_BATCH_MAX
+#define JERRYXX_TICKER_BATCH_MAX 256
+#endif /* !defined (JERRYXX_TICKER_BATCH_MAX) */
+
+/**
+ * Shortest period of a native ticker in microseconds.
+ */
+#ifndef JERRYXX_TICKER_MIN_PERIOD_US
+#define JERRYXX_TICKER_MIN_PERIOD_US 20
+#endif /* !defined (JERRYXX_TICKER_MIN_PERIOD_US) */
+
+/**
+ * Number of pin interrupt edges queued for their JavaScript handlers, must be a power of two.
+ */
+#ifndef JERRYXX_INTERRUPT_QUEUE_SIZE
+#define JERRYXX_INTERRUPT_QUEUE_SIZE 64
+#endif /* !defined (JERRYXX_INTERRUPT_QUEUE_SIZE) */
+
+/**
+ * Maximum number of edge timestamps delivered to an attachInterrupt handler in batch mode.
+ */
+#ifndef JERRYXX_INTERRUPT_BATCH_MAX
+#define JERRYXX_INTERRUPT_BATCH_MAX 1024
+#endif /* !defined (JERRYXX_INTERRUPT_BATCH_MAX) */
+
+/**
+ * Period in microseconds of the sampling of an Encoder, which extends its
+ * hardware counter and measures its velocity.
+ */
+#ifndef JERRYXX_ENCODER_SAMPLE_US
+#define JERRYXX_ENCODER_SAMPLE_US 10000
+#endif /* !defined (JERRYXX_ENCODER_SAMPLE_US) */
+
+/**
+ * Number of pulseInAsync measurements which can run at the same time.
+ */
+#ifndef JERRYXX_PULSE_COUNT
+#define JERRYXX_PULSE_COUNT 4
+#endif /* !defined (JERRYXX_PULSE_COUNT) */
+
+/**
+ * Shortest time in nanoseconds the clock of shiftOut and shiftIn on a buffer stays
+ * high or low, the bits are clocked natively and would be too fast for most devices.
+ */
+#ifndef JERRYXX_SHIFT_HALF_PERIOD_NS
+#define JERRYXX_SHIFT_HALF_PERIOD_NS 100
+#endif /* !defined (JERRYXX_SHIFT_HALF_PERIOD_NS) */
+
+/**
+ * Number of WaveformOut objects which can exist at the same time.
+ */
+#ifndef JERRYXX_WAVEFORM_COUNT
+#define JERRYXX_WAVEFORM_COUNT 2
+#endif /* !defined (JERRYXX_WAVEFORM_COUNT) */
+
+/**
+ * Highest sample rate of a WaveformOut in Hz, each sample is a timer interrupt.
+ */
+#ifndef JERRYXX_WAVEFORM_RATE_MAX
+#define JERRYXX_WAVEFORM_RATE_MAX 100000
+#endif /* !defined (JERRYXX_WAVEFORM_RATE_MAX) */
+
+/**
+ * Number of playSequence melodies which can play at the same time.
+ */
+#ifndef JERRYXX_SEQUENCE_COUNT
+#define JERRYXX_SEQUENCE_COUNT 2
+#endif /* !defined (JERRYXX_SEQUENCE_COUNT) */
+
+/**
+ * Highest frequency of a playSequence note in hertz: the square wave interrupts
+ * twice per period, 40000 times per second at the default.
+ */
+#ifndef JERRYXX_SEQUENCE_FREQUENCY_MAX
+#define JERRYXX_SEQUENCE_FREQUENCY_MAX 20000
+#endif /* !defined (JERRYXX_SEQUENCE_FREQUENCY_MAX) */
+
+/**
+ * Number of times a lane with work waiting can be passed over by the higher lanes
+ * before one of its callbacks runs first.
+ */
+#ifndef JERRYXX_LANE_STARVATION_LIMIT
+#define JERRYXX_LANE_STARVATION_LIMIT 16
+#endif /* !defined (JERRYXX_LANE_STARVATION_LIMIT) */
+
+/**
+ * Timeout of jerryxx_scheduler_idle which waits only for timers and events.
+ */
+#define JERRYXX_IDLE_FOREVER UINT32_MAX
 
 #define JERRYXX_BOOL_CHK(f)  \
     do                       \
@@ -91,6 +224,129 @@
     return jerry_throw_sz (JERRY_ERROR_TYPE, msg);     \
   }
 
+/**
+ * Declare var_p as the native pointer of the this value of a method of a
+ * native class, throwing a TypeError when this is not an object of the class.
+ */
+#define JERRYXX_GET_NATIVE_THIS_OR_THROW_ERROR_TYPE(type, var_p, info, msg)              \
+  type *var_p = (type *) jerry_object_get_native_ptr (call_info_p->this_value, &(info)); \
+  JERRYXX_ON_TYPE_CHECK_THROW_ERROR_TYPE (var_p == NULL, msg)
+
+/**
+ * Counters of the idle time of the event loop.
+ */
+typedef struct
+{
+  uint32_t sleeps;             /**< number of idle waits */
+  uint32_t event_wakeups;      /**< waits ended by jerryxx_scheduler_wake */
+  uint64_t idle_time;          /**< total time spent waiting in microseconds */
+  uint32_t last_wake_latency;  /**< delay of the last timed wake-up from its deadline in microseconds */
+  uint32_t max_wake_latency;   /**< maximum delay of a timed wake-up from its deadline in microseconds */
+} jerryxx_idle_stats_t;
+
+/**
+ * Lanes of the event loop, from the highest priority.
+ */
+typedef enum
+{
+  JERRYXX_LANE_INTERRUPT, /**< attachInterrupt handlers */
+  JERRYXX_LANE_IO,        /**< completed batches of the native tickers */
+  JERRYXX_LANE_TIMER,     /**< expired timers */
+  JERRYXX_LANE_IDLE,      /**< requestIdleCallback callbacks */
+  JERRYXX_LANE_COUNT,     /**< number of lanes */
+} jerryxx_lane_t;
+
+/**
+ * Counters of a lane of the event loop.
+ */
+typedef struct
+{
+  uint32_t pending;    /**< callbacks waiting to run */
+  uint32_t dispatched; /**< callbacks run */
+  uint32_t promoted;   /**< callbacks run ahead of a higher lane to prevent starvation */
+} jerryxx_lane_stats_t;
+
+/**
+ * Number of buckets of the timer lateness histogram, see jerryxx_loop_stats_t.
+ */
+#define JERRYXX_LATENESS_BUCKETS 8
+
+/**
+ * Counters of the work done by the event loop since the last reset.
+ */
+typedef struct
+{
+  uint32_t pending_timers;                     /**< timers armed or waiting for their callback */
+  uint32_t pending_callbacks;                  /**< callbacks waiting to run in all the lanes */
+  uint32_t max_pending_callbacks;              /**< maximum number of expired timers at the start of a pass */
+  uint32_t last_lag;                           /**< delay between the oldest deadline and the start of the last pass in microseconds */
+  uint32_t max_lag;                            /**< maximum lag of a pass in microseconds */
+  uint32_t callbacks;                          /**< number of callbacks called */
+  uint64_t callback_time;                      /**< total time spent in the callbacks and their jobs in microseconds */
+  uint32_t max_callback_time;                  /**< longest callback, jobs included, in microseconds */
+  uint32_t coalesced;                          /**< timer calls delayed within their slack to share a wake-up */
+  uint32_t lateness[JERRYXX_LATENESS_BUCKETS]; /**< timers fired per range of lateness, see jerryxx_lateness_bounds */
+  jerryxx_lane_stats_t lanes[JERRYXX_LANE_COUNT]; /**< counters of the lanes */
+} jerryxx_loop_stats_t;
+
+/**
+ * Counters of the pin changes scheduled by digitalWriteAt.
+ */
+typedef struct
+{
+  uint32_t pending;   /**< changes waiting for their time */
+  uint32_t queued;    /**< changes queued */
+  uint32_t fired;     /**< changes applied */
+  uint32_t late;      /**< changes queued when their time was already past, applied at once */
+  uint32_t max_error; /**< maximum delay of a change from its time in microseconds */
+} jerryxx_gpio_action_stats_t;
+
+/**
+ * Counters of the edges queued by the pin interrupts of attachInterrupt.
+ */
+typedef struct
+{
+  uint32_t pending;     /**< edges waiting for their handler */
+  uint32_t queued;      /**< edges queued */
+  uint32_t dispatched;  /**< edges delivered to a handler */
+  uint32_t overflows;   /**< edges dropped because the queue was full */
+  uint32_t glitches;    /**< edges rejected by the debounce and glitch filters */
+  uint32_t max_pending; /**< maximum number of edges waiting at the same time */
+} jerryxx_interrupt_stats_t;
+
+/**
+ * Stages of the latency of an attachInterrupt handler, measured from the interrupt.
+ */
+typedef enum
+{
+  JERRYXX_LATENCY_DEQUEUE,  /**< from the interrupt to the edge taken from the queue by the event loop */
+  JERRYXX_LATENCY_START,    /**< from the interrupt to the call of the handler */
+  JERRYXX_LATENCY_CALLBACK, /**< from the call of the handler to its return, jobs included */
+  JERRYXX_LATENCY_COUNT,    /**< number of stages */
+} jerryxx_latency_stage_t;
+
+/**
+ * Summary of the latencies of a stage, in microseconds.
+ */
+typedef struct
+{
+  uint32_t count; /**< number of samples */
+  uint32_t min;   /**< shortest */
+  uint32_t avg;   /**< average */
+  uint32_t max;   /**< longest */
+  uint32_t p99;   /**< 99th percentile, upper bound of its histogram bucket */
+} jerryxx_latency_summary_t;
+
+/**
+ * What happens when a callback runs past its time budget.
+ */
+typedef enum
+{
+  JERRYXX_BUDGET_THROW,  /**< throw a RangeError, thrown again by every check until the callback ends */
+  JERRYXX_BUDGET_ABORT,  /**< abort the callback, cannot be caught by the script */
+  JERRYXX_BUDGET_REPORT, /**< log a warning and let the callback continue */
+} jerryxx_budget_mode_t;
+
 /**
  * Register a JavaScript property in the global object.
  *
@@ -103,22 +359,115 @@ jerryxx_register_global_property (const char *name_p, /**< name of the property
                                   bool free_value); /**< take ownership of the value */
 
 /**
- * Run JavaScript scheduler (user for switch setTimeout and setInterval threads).
+ * Run all the enqueued Promise jobs, reporting the exceptions they throw.
+ * Must be called from the thread which owns the engine.
+ */
+void
+jerryxx_run_jobs(void);
+
+/**
+ * Run JavaScript scheduler: call the callbacks of the pending events, one at
+ * a time from the highest non-empty lane: interrupts, I/O (ticker and
+ * interrupt batches, measurements, waveform passes, melodies), timers, idle.
+ * A pass serves only the work waiting when it began, so a stream of edges
+ * cannot hold back the timers; the caller runs the next pass.
+ * Must be called from the thread which owns the engine.
  *
- * @return true - if the operation was successful,
+ * @return true - if there are timers, tickers, interrupt handlers, measurements, waveforms or melodies still pending,
  *         false - otherwise.
  */
 bool
 jerryxx_scheduler_yield(void);
 
 /**
- * Cleanup scheduler thread in state Deleted.
+ * Wake up the event loop from its idle wait. Safe to call from interrupts.
+ */
+void
+jerryxx_scheduler_wake(void);
+
+/**
+ * Block the engine thread on the wake event flag until the next timer
+ * expires, or at most for the given time. No tick runs while waiting,
+ * so the MCU can stay in the low power mode between the events.
+ */
+void
+jerryxx_scheduler_idle(uint32_t timeout_ms); /**< maximum wait, JERRYXX_IDLE_FOREVER to wait only for timers and events */
+
+/**
+ * Get the counters of the idle time of the event loop.
+ */
+void
+jerryxx_get_idle_stats(jerryxx_idle_stats_t *stats_p); /**< [out] counters */
+
+/**
+ * Upper bounds, in microseconds, of the buckets of the timer lateness histogram.
+ */
+extern const uint32_t jerryxx_lateness_bounds[JERRYXX_LATENESS_BUCKETS];
+
+/**
+ * Get the counters of the work done by the event loop.
+ */
+void
+jerryxx_get_loop_stats(jerryxx_loop_stats_t *stats_p); /**< [out] counters */
+
+/**
+ * Reset the counters of the event loop, of its idle time and of the callback budget.
+ */
+void
+jerryxx_reset_loop_stats(void);
+
+/**
+ * Set the CPU time budget of every callback called by the event loop.
+ * Requires JERRY_VM_HALT, must be called after jerry_init.
+ *
+ * @return true - if the operation was successful,
+ *         false - if the engine was built without JERRY_VM_HALT.
+ */
+bool
+jerryxx_set_callback_budget(uint32_t budget_ms, /**< budget in milliseconds, 0 to disable it */
+                            jerryxx_budget_mode_t mode, /**< action on overrun */
+                            uint32_t interval); /**< VM halt checks between two reads of the clock */
+
+/**
+ * Get the counters of the pin changes scheduled by digitalWriteAt.
+ */
+void
+jerryxx_get_gpio_action_stats(jerryxx_gpio_action_stats_t *stats_p); /**< [out] counters */
+
+/**
+ * Get the counters of the edges queued by the pin interrupts.
+ */
+void
+jerryxx_get_interrupt_stats(jerryxx_interrupt_stats_t *stats_p); /**< [out] counters */
+
+/**
+ * Get the summaries of the latencies of the handlers of attachInterrupt, per
+ * jerryxx_latency_stage_t. Edges delivered in batches are not measured.
+ */
+void
+jerryxx_get_interrupt_latency(jerryxx_latency_summary_t summaries[JERRYXX_LATENCY_COUNT]); /**< [out] summary per stage */
+
+/**
+ * Reset the latencies of the handlers of attachInterrupt.
+ */
+void
+jerryxx_reset_interrupt_latency(void);
+
+/**
+ * Run JavaScript event loop until there are no more pending timers.
+ * Must be called from the thread which owns the engine.
  *
  * @return true - if the operation was successful,
  *         false - otherwise.
  */
 bool
-jerryxx_cleanup_scheduler_map(void);
+jerryxx_run_event_loop(void);
+
+/**
+ * Release all the pending timers, must be called before jerry_cleanup.
+ */
+void
+jerryxx_cleanup_scheduler(void);
 
 /**
  * Register Extra API into JavaScript global object.
@@ -149,6 +498,61 @@ JERRYXX_DEFINE_FUNCTION(set_interval);
  */
 JERRYXX_DEFINE_FUNCTION(clear_interval);
 
+/**
+ * Javascript: requestIdleCallback
+ */
+JERRYXX_DEFINE_FUNCTION(request_idle_callback);
+
+/**
+ * Javascript: cancelIdleCallback
+ */
+JERRYXX_DEFINE_FUNCTION(cancel_idle_callback);
+
+/**
+ * Javascript: queueMicrotask
+ */
+JERRYXX_DEFINE_FUNCTION(queue_microtask);
+
+/**
+ * Javascript: setCallbackBudget
+ */
+JERRYXX_DEFINE_FUNCTION(set_callback_budget);
+
+/**
+ * Javascript: delayAsync
+ */
+JERRYXX_DEFINE_FUNCTION(delay_async);
+
+/**
+ * Javascript: getIntervalStats
+ */
+JERRYXX_DEFINE_FUNCTION(get_interval_stats);
+
+/**
+ * Javascript: setTicker
+ */
+JERRYXX_DEFINE_FUNCTION(set_ticker);
+
+/**
+ * Javascript: clearTicker
+ */
+JERRYXX_DEFINE_FUNCTION(clear_ticker);
+
+/**
+ * Javascript: getTickerStats
+ */
+JERRYXX_DEFINE_FUNCTION(get_ticker_stats);
+
+/**
+ * Javascript: runtime.stats
+ */
+JERRYXX_DEFINE_FUNCTION(runtime_stats);
+
+/**
+ * Javascript: runtime.resetStats
+ */
+JERRYXX_DEFINE_FUNCTION(runtime_reset_stats);
+
 /*******************************************************************************
  *                                  Arduino API                                *
  ******************************************************************************/
@@ -177,6 +581,121 @@ JERRYXX_DEFINE_FUNCTION(digital_write);
  */
 JERRYXX_DEFINE_FUNCTION(digital_read);
 
+/**
+ * Arduino: DigitalOut
+ */
+JERRYXX_DEFINE_FUNCTION(digital_out);
+
+/**
+ * Arduino: DigitalOut.prototype.write
+ */
+JERRYXX_DEFINE_FUNCTION(digital_out_write);
+
+/**
+ * Arduino: DigitalOut.prototype.read
+ */
+JERRYXX_DEFINE_FUNCTION(digital_out_read);
+
+/**
+ * Arduino: DigitalOut.prototype.toggle
+ */
+JERRYXX_DEFINE_FUNCTION(digital_out_toggle);
+
+/**
+ * Arduino: DigitalIn
+ */
+JERRYXX_DEFINE_FUNCTION(digital_in);
+
+/**
+ * Arduino: DigitalIn.prototype.read
+ */
+JERRYXX_DEFINE_FUNCTION(digital_in_read);
+
+/**
+ * Arduino: digitalPinToPort
+ */
+JERRYXX_DEFINE_FUNCTION(digital_pin_to_port);
+
+/**
+ * Arduino: digitalPinToBitMask
+ */
+JERRYXX_DEFINE_FUNCTION(digital_pin_to_bit_mask);
+
+/**
+ * Arduino: portWrite
+ */
+JERRYXX_DEFINE_FUNCTION(port_write);
+
+/**
+ * Arduino: portRead
+ */
+JERRYXX_DEFINE_FUNCTION(port_read);
+
+/**
+ * Arduino: PinGroup
+ */
+JERRYXX_DEFINE_FUNCTION(pin_group);
+
+/**
+ * Arduino: PinGroup.prototype.write
+ */
+JERRYXX_DEFINE_FUNCTION(pin_group_write);
+
+/**
+ * Arduino: PinGroup.prototype.read
+ */
+JERRYXX_DEFINE_FUNCTION(pin_group_read);
+
+/**
+ * Arduino: WaveformOut
+ */
+JERRYXX_DEFINE_FUNCTION(waveform_out);
+
+/**
+ * Arduino: WaveformOut.prototype.play
+ */
+JERRYXX_DEFINE_FUNCTION(waveform_out_play);
+
+/**
+ * Arduino: WaveformOut.prototype.loop
+ */
+JERRYXX_DEFINE_FUNCTION(waveform_out_loop);
+
+/**
+ * Arduino: WaveformOut.prototype.stop
+ */
+JERRYXX_DEFINE_FUNCTION(waveform_out_stop);
+
+/**
+ * Arduino: WaveformOut.prototype.close
+ */
+JERRYXX_DEFINE_FUNCTION(waveform_out_close);
+
+/**
+ * Arduino: WaveformOut.prototype.playing
+ */
+JERRYXX_DEFINE_FUNCTION(waveform_out_playing);
+
+/**
+ * Arduino: WaveformOut.prototype.passes
+ */
+JERRYXX_DEFINE_FUNCTION(waveform_out_passes);
+
+/**
+ * Arduino: digitalWriteAt
+ */
+JERRYXX_DEFINE_FUNCTION(digital_write_at);
+
+/**
+ * Arduino: digitalWriteAtBatch
+ */
+JERRYXX_DEFINE_FUNCTION(digital_write_at_batch);
+
+/**
+ * Arduino: getDigitalWriteAtStats
+ */
+JERRYXX_DEFINE_FUNCTION(get_digital_write_at_stats);
+
 /**
  * Arduino: delay
  */
@@ -217,6 +736,36 @@ JERRYXX_DEFINE_FUNCTION(analog_read);
  */
 JERRYXX_DEFINE_FUNCTION(analog_write);
 
+/**
+ * Arduino: PwmOut
+ */
+JERRYXX_DEFINE_FUNCTION(pwm_out);
+
+/**
+ * Arduino: PwmOut.prototype.duty
+ */
+JERRYXX_DEFINE_FUNCTION(pwm_out_duty);
+
+/**
+ * Arduino: PwmOut.prototype.close
+ */
+JERRYXX_DEFINE_FUNCTION(pwm_out_close);
+
+/**
+ * Arduino: PwmOut.prototype.frequency
+ */
+JERRYXX_DEFINE_FUNCTION(pwm_out_frequency);
+
+/**
+ * Arduino: PwmGroup
+ */
+JERRYXX_DEFINE_FUNCTION(pwm_group);
+
+/**
+ * Arduino: PwmGroup.prototype.update
+ */
+JERRYXX_DEFINE_FUNCTION(pwm_group_update);
+
 /**
  * Arduino: analogReadResolution
  */
@@ -247,6 +796,61 @@ JERRYXX_DEFINE_FUNCTION(attach_interrupt);
  */
 JERRYXX_DEFINE_FUNCTION(detach_interrupt);
 
+/**
+ * Arduino: getInterruptStats
+ */
+JERRYXX_DEFINE_FUNCTION(get_interrupt_stats);
+
+/**
+ * Arduino: getInterruptLatency
+ */
+JERRYXX_DEFINE_FUNCTION(get_interrupt_latency);
+
+/**
+ * Arduino: resetInterruptLatency
+ */
+JERRYXX_DEFINE_FUNCTION(reset_interrupt_latency);
+
+/**
+ * Arduino: Encoder
+ */
+JERRYXX_DEFINE_FUNCTION(encoder);
+
+/**
+ * Arduino: Encoder.prototype.reset
+ */
+JERRYXX_DEFINE_FUNCTION(encoder_reset);
+
+/**
+ * Arduino: Encoder.prototype.close
+ */
+JERRYXX_DEFINE_FUNCTION(encoder_close);
+
+/**
+ * Arduino: Encoder.prototype.position
+ */
+JERRYXX_DEFINE_FUNCTION(encoder_position);
+
+/**
+ * Arduino: Encoder.prototype.velocity
+ */
+JERRYXX_DEFINE_FUNCTION(encoder_velocity);
+
+/**
+ * Arduino: Encoder.prototype.overflows
+ */
+JERRYXX_DEFINE_FUNCTION(encoder_overflows);
+
+/**
+ * Arduino: Encoder.prototype.errors
+ */
+JERRYXX_DEFINE_FUNCTION(encoder_errors);
+
+/**
+ * Arduino: Encoder.prototype.hardware
+ */
+JERRYXX_DEFINE_FUNCTION(encoder_hardware);
+
 /**
  * Arduino: noTone
  */
@@ -262,6 +866,61 @@ JERRYXX_DEFINE_FUNCTION(pulse_in);
  */
 JERRYXX_DEFINE_FUNCTION(pulse_in_long);
 
+/**
+ * Arduino: pulseInAsync
+ */
+JERRYXX_DEFINE_FUNCTION(pulse_in_async);
+
+/**
+ * Arduino: FrequencyCounter
+ */
+JERRYXX_DEFINE_FUNCTION(frequency_counter);
+
+/**
+ * Arduino: FrequencyCounter.prototype.reset
+ */
+JERRYXX_DEFINE_FUNCTION(frequency_counter_reset);
+
+/**
+ * Arduino: FrequencyCounter.prototype.close
+ */
+JERRYXX_DEFINE_FUNCTION(frequency_counter_close);
+
+/**
+ * Arduino: FrequencyCounter.prototype.frequency
+ */
+JERRYXX_DEFINE_FUNCTION(frequency_counter_frequency);
+
+/**
+ * Arduino: FrequencyCounter.prototype.period
+ */
+JERRYXX_DEFINE_FUNCTION(frequency_counter_period);
+
+/**
+ * Arduino: FrequencyCounter.prototype.duty
+ */
+JERRYXX_DEFINE_FUNCTION(frequency_counter_duty);
+
+/**
+ * Arduino: FrequencyCounter.prototype.minFrequency
+ */
+JERRYXX_DEFINE_FUNCTION(frequency_counter_min_frequency);
+
+/**
+ * Arduino: FrequencyCounter.prototype.maxFrequency
+ */
+JERRYXX_DEFINE_FUNCTION(frequency_counter_max_frequency);
+
+/**
+ * Arduino: FrequencyCounter.prototype.gates
+ */
+JERRYXX_DEFINE_FUNCTION(frequency_counter_gates);
+
+/**
+ * Arduino: FrequencyCounter.prototype.edges
+ */
+JERRYXX_DEFINE_FUNCTION(frequency_counter_edges);
+
 /**
  * Arduino: shiftIn
  */
@@ -277,6 +936,11 @@ JERRYXX_DEFINE_FUNCTION(shift_out);
  */
 JERRYXX_DEFINE_FUNCTION(tone);
 
+/**
+ * Arduino: playSequence
+ */
+JERRYXX_DEFINE_FUNCTION(play_sequence);
+
 /**
  * Arduino: bit
  */
@@ -22,6 +22,7 @@
 #define JERRY_ERROR_MESSAGES 1
 #define JERRY_GLOBAL_HEAP_SIZE 128
 #define JERRY_CPOINTER_32_BIT 1
+#define JERRY_VM_HALT 1
 
 
 /**